@@ -9,10 +9,12 @@
 #ifndef Algorithm_h
 #define Algorithm_h
 
+#include <cstddef>
 #include <vector>
 
 namespace stk {
 namespace mesh {
+class FieldBase;
 class Part;
 typedef std::vector<Part*> PartVector;
 }
@@ -51,11 +53,32 @@ public:
 
   virtual void set_bool(bool theBool) {}
 
+  // lazy property evaluation; an algorithm that declares the fields it reads
+  // is skipped while none of them changed since it last ran. Its output is
+  // stamped whenever it runs so that dependent algorithms rerun; algorithms
+  // that cannot report their inputs still declare the output
+  void declare_output(
+    const stk::mesh::FieldBase *outputField);
+
+  void declare_dependencies(
+    const stk::mesh::FieldBase *outputField,
+    const std::vector<const stk::mesh::FieldBase *> &inputFields);
+
+  bool dependencies_modified() const;
+
+  void mark_evaluated();
+
   Realm &realm_;
   stk::mesh::PartVector partVec_;
   std::vector<SupplementalAlgorithm *> supplementalAlg_;
 
   std::vector<Kernel*> activeKernels_;
+
+  bool dependenciesDeclared_;
+  const stk::mesh::FieldBase *outputField_;
+  std::vector<const stk::mesh::FieldBase *> inputFields_;
+  bool evaluated_;
+  size_t evaluationStamp_;
 };
 
 } // namespace nalu
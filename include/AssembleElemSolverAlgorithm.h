@@ -18,6 +18,7 @@
 #include <SharedMemData.h>
 #include<CopyAndInterleave.h>
 #include<FieldTypeDef.h>
+#include<GeometryCache.h>
 
 namespace stk {
 namespace mesh {
@@ -67,6 +68,13 @@ public:
    stk::mesh::BucketVector const& elem_buckets =
            realm_.get_buckets(entityRank_, elemSelector );
  
+   // master element data of a static mesh is read back instead of recomputed
+   std::vector<GeometryCache::BucketRecords> geomRecords;
+   GeometryCache *geometryCache = realm_.geometryCache_;
+   const bool useGeometryCache = (nullptr != geometryCache)
+     && geometryCache->prepare(bulk_data, dataNeededByKernels_, realm_.does_mesh_move(),
+                               interleaveMEViews_, elem_buckets, geomRecords);
+
    auto team_exec = sierra::nalu::get_team_policy(elem_buckets.size(), bytes_per_team, bytes_per_thread);
    Kokkos::parallel_for(team_exec, [&](const sierra::nalu::TeamHandleType& team)
    {
@@ -80,6 +88,12 @@ public:
 
      const size_t bucketLen   = b.size();
      const size_t simdBucketLen = get_num_simd_groups(bucketLen);
+
+     const GeometryCache::BucketRecords *bucketGeom =
+       (useGeometryCache && !geomRecords[team.league_rank()].records_.empty())
+       ? &geomRecords[team.league_rank()] : nullptr;
+     const bool loadGeom = (nullptr != bucketGeom) && bucketGeom->filled_;
+     const bool fillMEViews = interleaveMEViews_ && !loadGeom;
  
      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, simdBucketLen), [&](const size_t& bktIndex)
      {
@@ -90,18 +104,29 @@ public:
          stk::mesh::Entity element = b[bktIndex*simdLen + simdElemIndex];
          smdata.elemNodes[simdElemIndex] = bulk_data.begin_nodes(element);
          fill_pre_req_data(dataNeededByKernels_, bulk_data, element,
-                           *smdata.prereqData[simdElemIndex], interleaveMEViews_);
+                           *smdata.prereqData[simdElemIndex], fillMEViews);
        }
  
-       copy_and_interleave(smdata.prereqData, numSimdElems, smdata.simdPrereqData, interleaveMEViews_);
+       copy_and_interleave(smdata.prereqData, numSimdElems, smdata.simdPrereqData, fillMEViews);
  
-       if (!interleaveMEViews_) {
-         fill_master_element_views(dataNeededByKernels_, bulk_data, smdata.simdPrereqData);
+       if (loadGeom) {
+         GeometryCache::load(*bucketGeom, bktIndex, smdata.simdPrereqData);
+       }
+       else {
+         if (!interleaveMEViews_) {
+           fill_master_element_views(dataNeededByKernels_, bulk_data, smdata.simdPrereqData);
+         }
+         if (nullptr != bucketGeom) {
+           GeometryCache::store(*bucketGeom, bktIndex, smdata.simdPrereqData);
+         }
        }
 
        lambdaFunc(smdata);
      });
    });
+
+   if (useGeometryCache)
+     geometryCache->commit(geomRecords);
   }
 
   ElemDataRequests dataNeededByKernels_;
@@ -13,6 +13,8 @@
 #include<FieldTypeDef.h>
 #include<EigenDecomposition.h>
 
+#include <stk_mesh/base/Entity.hpp>
+
 namespace stk {
 namespace mesh {
 class Part;
@@ -82,13 +84,34 @@ public:
   const double perturbTurbKe_;
   double BinvXt_[3];
 
+  // edge quantities computed before and used after the batched
+  // eigendecomposition of simdLen edges
+  struct EdgeLane
+  {
+    stk::mesh::Entity nodes_[2];
+    double areaVec_[3];
+    double dqdxj_[3];
+    const double *coordL_;
+    const double *coordR_;
+    const double *dqdxL_;
+    const double *dqdxR_;
+    double qNp1L_;
+    double qNp1R_;
+    double tmdot_;
+    double asq_;
+    double inv_axdx_;
+    double udotx_;
+    double rhoIp_;
+    double lamEffectiveViscIp_;
+    double nuIp_;
+    double turbKeIp_;
+    double timeScaleIp_;
+  };
+
   // fixed size
   double duidxj_[3][3];
-  double dqdxj_[3];
   double R_[3][3];
-  double b_[3][3];
   double D_[3][3];
-  double Q_[3][3];
   int rowMap_[3];
 };
 
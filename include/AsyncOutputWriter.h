@@ -0,0 +1,130 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef AsyncOutputWriter_h
+#define AsyncOutputWriter_h
+
+#include <mpi.h>
+
+#include <functional>
+#include <future>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace stk {
+namespace io {
+class StkMeshIoBroker;
+}
+namespace mesh {
+class BulkData;
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// AsyncOutputWriter
+//=============================================================================
+/**
+ * * @par Description:
+ * - Snapshot output fields into staging copies and hand the actual database
+ *   write to a background thread so that time stepping can continue.
+ *
+ * @par Design Considerations:
+ * - Staging fields are declared before the meta data is committed and are
+ *   registered with the writer's own io broker in place of the solution
+ *   fields.
+ * - Every staged state is a single-state field written under the restart
+ *   name of that state, so state rotation never touches a staged copy.
+ * - The broker runs on a duplicate of the mesh communicator, so collectives
+ *   issued by the writer thread never match those of the solver.
+ * - The output mesh is defined on the calling thread; the background write
+ *   only reads the staged fields and the (unmodified) mesh.
+ * - A single staging buffer provides the back-pressure: staging the next
+ *   step waits for the pending write to complete.
+ * - Callers must flush() before any mesh modification.
+ * - Without MPI_THREAD_MULTIPLE the write runs inline.
+ */
+//=============================================================================
+
+class AsyncOutputWriter
+{
+public:
+
+  AsyncOutputWriter(
+    stk::mesh::BulkData &bulkData,
+    const std::string &stagingSuffix);
+  ~AsyncOutputWriter();
+
+  // declare the staging copies; must be called before commit
+  // (restart output needs every state of a multi-state field);
+  // false if a field can not be staged and must be written synchronously
+  bool register_fields(
+    const std::set<std::string> &fieldNameSet,
+    const bool stageAllStates = false);
+
+  // broker that owns the output databases written by this writer
+  stk::io::StkMeshIoBroker &io_broker() { return *ioBroker_; }
+
+  // add the staged copy of a field to an output database; false if not staged
+  bool add_output_field(
+    const size_t outputIndex,
+    const std::string &fieldName);
+
+  // write the mesh definition now, on the calling thread
+  void define_output_mesh(const size_t outputIndex);
+
+  // copy the current solution into the staging fields
+  void stage();
+
+  // run the write on the background thread; waits on the pending write first
+  void launch(const std::function<void()> &writeTask);
+
+  // block until the pending write has completed
+  void flush();
+
+  bool is_asynchronous() const { return asynchronous_; }
+  double get_stage_time() const { return timerStage_; }
+  double get_stall_time() const { return timerStall_; }
+
+private:
+
+  stk::mesh::BulkData &bulkData_;
+  const std::string stagingSuffix_;
+  bool asynchronous_;
+
+  // private communicator and broker for the writer thread
+  MPI_Comm ioComm_;
+  stk::io::StkMeshIoBroker *ioBroker_;
+
+  // one staged state of a solution field
+  struct StagedState {
+    stk::mesh::FieldBase *solutionField_;
+    stk::mesh::FieldBase *stagedField_;
+    std::string databaseName_;
+  };
+
+  // solution field name to its staged states
+  std::map<std::string, std::vector<StagedState> > stagedFieldMap_;
+
+  std::future<void> pendingWrite_;
+
+  double timerStage_;
+  double timerStall_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,96 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef BucketCache_h
+#define BucketCache_h
+
+#include <stk_mesh/base/Selector.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// BucketCache
+//=============================================================================
+/**
+ * * @par Description:
+ * - Selector to bucket list cache; repeated requests for the same rank and
+ *   selector return the same BucketVector without reevaluating the selector
+ *   against every bucket of the rank.
+ *
+ * @par Design Considerations:
+ * - Lists are keyed by rank and selector and dropped when the bulk data
+ *   synchronized count changes; while the mesh is being modified the cache
+ *   is bypassed altogether.
+ * - Each list carries per-bucket metadata (entity and SIMD group counts)
+ *   computed once, when the list is gathered.
+ * - References stay valid until the next mesh modification, as they do for
+ *   stk::mesh::BulkData::get_buckets.
+ */
+//=============================================================================
+
+class BucketCache
+{
+public:
+
+  // a cached bucket list and its per-bucket metadata
+  struct BucketList
+  {
+    stk::mesh::BucketVector buckets_;
+    std::vector<size_t> numEntities_;
+    std::vector<size_t> numSimdGroups_;
+    size_t totalEntities_;
+    size_t totalSimdGroups_;
+  };
+
+  BucketCache();
+  ~BucketCache() {}
+
+  // cached buckets of rank selected by selector
+  const stk::mesh::BucketVector & get_buckets(
+    const stk::mesh::BulkData &bulkData,
+    const stk::mesh::EntityRank rank,
+    const stk::mesh::Selector &selector);
+
+  // cached buckets with metadata; only valid outside of mesh modification
+  const BucketList & get_bucket_list(
+    const stk::mesh::BulkData &bulkData,
+    const stk::mesh::EntityRank rank,
+    const stk::mesh::Selector &selector);
+
+  // drop all lists
+  void invalidate();
+
+  size_t num_hits() const { return numHits_; }
+  size_t num_misses() const { return numMisses_; }
+
+private:
+
+  size_t syncCount_;
+  size_t numHits_;
+  size_t numMisses_;
+  std::map<stk::mesh::EntityRank, std::map<stk::mesh::Selector, BucketList> > lists_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
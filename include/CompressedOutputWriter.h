@@ -0,0 +1,90 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef CompressedOutputWriter_h
+#define CompressedOutputWriter_h
+
+#include <OutputInfo.h>
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+namespace utils {
+class CompressedFieldFileWriter;
+}
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// CompressedOutputWriter
+//=============================================================================
+/**
+ * * @par Description:
+ * - Write node fields with per-field, error-bounded lossy compression to one
+ *   file per rank (see utils/FieldCompression.h for the layout and reader).
+ *
+ * @par Design Considerations:
+ * - Only locally owned nodes are written, in bucket order, so that every node
+ *   appears exactly once over all files.
+ * - The node set is fixed at initialize(); the mesh topology must not change.
+ */
+//=============================================================================
+
+class CompressedOutputWriter
+{
+public:
+
+  CompressedOutputWriter(
+    stk::mesh::BulkData &bulkData,
+    const std::string &fileBaseName,
+    const std::vector<CompressedFieldSpec> &fieldSpecs);
+  ~CompressedOutputWriter();
+
+  // resolve the fields, gather the owned node list and define the file
+  void initialize();
+
+  // compress and append one step
+  void write_step(const double currentTime);
+
+  // compression ratio and time over all ranks
+  void provide_summary();
+
+private:
+
+  stk::mesh::BulkData &bulkData_;
+  const std::string fileBaseName_;
+  const std::vector<CompressedFieldSpec> fieldSpecs_;
+
+  std::vector<stk::mesh::FieldBase *> fields_;
+  std::vector<unsigned> numComponents_;
+  std::vector<std::vector<stk::mesh::Entity> > fieldNodes_;
+  std::vector<std::vector<double> > scratch_;
+
+  std::unique_ptr<utils::CompressedFieldFileWriter> file_;
+
+  double uncompressedBytes_;
+  double timerWrite_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
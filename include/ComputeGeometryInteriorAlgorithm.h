@@ -27,7 +27,10 @@ public:
     Realm &realm,
     stk::mesh::Part *part);
   ~ComputeGeometryInteriorAlgorithm();
-  
+
+  // single sweep over SIMD groups of elements, threaded over buckets;
+  // dual_nodal_volume and edge_area_vector are accumulated atomically, or
+  // color by color when use_element_coloring is set
   void execute();
 
   const bool assembleEdgeAreaVec_;
@@ -10,6 +10,7 @@
 #define DataProbePostProcessing_h
 
 #include <NaluParsing.h>
+#include <ProbeStatistics.h>
 
 #include <string>
 #include <vector>
@@ -96,6 +97,30 @@ public:
  ~RingProbeType() {}
 };
 
+class DataProbeStatisticsInfo {
+public:
+  DataProbeStatisticsInfo();
+  ~DataProbeStatisticsInfo();
+
+  // user options
+  int sampleFreq_;
+  int windowLength_;
+  int windowOverlap_;
+  int maxTimeLag_;
+  int maxSeparation_;
+  bool writeRawProbes_;
+
+  // time of the previous sample; defines the sample interval
+  double previousSampleTime_;
+
+  // one accumulator per line/plane probe, field and component on this rank
+  std::vector<const DataProbeInfo *> probeInfo_;
+  std::vector<int> probeIndex_;
+  std::vector<int> fieldIndex_;
+  std::vector<int> component_;
+  std::vector<ProbeStatistics *> statistics_;
+};
+
 class DataProbeSpecInfo {
 public:
   DataProbeSpecInfo();
@@ -113,6 +138,9 @@ public:
 
   // vector of probe types
   std::vector<ProbeType *> probeTypeVec_;
+
+  // in-situ statistics on the probes (optional)
+  DataProbeStatisticsInfo *statisticsInfo_;
 };
 
 class DataProbePostProcessing
@@ -151,6 +179,15 @@ public:
 
   // output to a file
   void provide_output(const double currentTime);
+
+  // create the statistics accumulators for the probes on this rank
+  void initialize_statistics();
+
+  // add the current probe values to the statistics
+  void accumulate_statistics(const double currentTime, const int timeStepCount);
+
+  // write the accumulated statistics (overwrites the previous files)
+  void provide_statistics_output();
   
   // general rotation matrix about a unit normal centered at origin (0,0,0)
   void compute_R(const double theta, const std::vector<double> &u, std::vector<double> &R);
@@ -0,0 +1,178 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef EntityHilbertSorter_h
+#define EntityHilbertSorter_h
+
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/MetaData.hpp>
+#include <stk_mesh/base/Field.hpp>
+#include <stk_mesh/base/EntitySorterBase.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// EntityHilbertSorter
+//=============================================================================
+/**
+ * * @par Description:
+ * - Class that sorts bucket contents along a Hilbert space-filling curve.
+ *
+ * @par Design Considerations:
+ * - Nodes are keyed by their coordinates; edges and elements by the centroid
+ *   of their nodes. Entities that are close in space end up close in memory,
+ *   which improves the cache reuse of the node gathers in edge and element
+ *   loops.
+ * - Faces are left alone so that EntityExposedFaceSorter keeps control of the
+ *   exposed face ordering in 3D. In 2D the edges are the side rank; they are
+ *   sorted here like the 3D edges, and EntityExposedFaceSorter, which runs
+ *   later, still has the last word on them when it is active.
+ * - STK only reorders within a bucket; bucket membership is set by the parts.
+ */
+//=============================================================================
+
+class EntityHilbertSorter : public stk::mesh::EntitySorterBase {
+
+  public:
+
+  // number of bits per spatial direction; 3*21 fits into 64 bits
+  static constexpr int numBits_ = 21;
+
+  EntityHilbertSorter(
+    const stk::mesh::Field<double> &coordinates,
+    const int nDim,
+    const double *minCorner,
+    const double *maxCorner)
+    : coordinates_(coordinates),
+      nDim_(nDim)
+  {
+    for ( int j = 0; j < 3; ++j ) {
+      minCorner_[j] = (j < nDim) ? minCorner[j] : 0.0;
+      const double extent = (j < nDim) ? maxCorner[j] - minCorner[j] : 0.0;
+      invExtent_[j] = extent > 0.0 ? 1.0/extent : 0.0;
+    }
+  }
+
+  virtual void sort(stk::mesh::BulkData &bulk, stk::mesh::EntityVector& entityVector) const
+  {
+    if ( entityVector.empty() )
+      return;
+
+    const stk::mesh::EntityRank entityVecRank = bulk.entity_rank(entityVector[0]);
+    if ( entityVecRank == stk::topology::FACE_RANK || entityVecRank > stk::topology::ELEM_RANK )
+      return;
+
+    std::vector<std::pair<uint64_t, stk::mesh::Entity> > keyedEntities;
+    keyedEntities.reserve(entityVector.size());
+
+    double centroid[3];
+    for ( stk::mesh::Entity entity : entityVector ) {
+      if ( entityVecRank == stk::topology::NODE_RANK ) {
+        const double *coords = stk::mesh::field_data(coordinates_, entity);
+        for ( int j = 0; j < nDim_; ++j )
+          centroid[j] = coords[j];
+      }
+      else {
+        for ( int j = 0; j < nDim_; ++j )
+          centroid[j] = 0.0;
+        const stk::mesh::Entity *nodes = bulk.begin_nodes(entity);
+        const unsigned numNodes = bulk.num_nodes(entity);
+        for ( unsigned ni = 0; ni < numNodes; ++ni ) {
+          const double *coords = stk::mesh::field_data(coordinates_, nodes[ni]);
+          for ( int j = 0; j < nDim_; ++j )
+            centroid[j] += coords[j];
+        }
+        const double inv = numNodes > 0 ? 1.0/numNodes : 0.0;
+        for ( int j = 0; j < nDim_; ++j )
+          centroid[j] *= inv;
+      }
+      keyedEntities.push_back(std::make_pair(hilbert_key(centroid), entity));
+    }
+
+    std::stable_sort(keyedEntities.begin(), keyedEntities.end(),
+      [](const std::pair<uint64_t, stk::mesh::Entity> &a,
+         const std::pair<uint64_t, stk::mesh::Entity> &b) {
+        return a.first < b.first; });
+
+    for ( size_t k = 0; k < keyedEntities.size(); ++k )
+      entityVector[k] = keyedEntities[k].second;
+  }
+
+  // map a point within the bounding box to its distance along the curve
+  uint64_t hilbert_key(const double *x) const
+  {
+    const uint32_t maxCoord = (1u << numBits_) - 1u;
+    uint32_t ix[3] = {0u, 0u, 0u};
+    for ( int j = 0; j < nDim_; ++j ) {
+      const double scaled = (x[j] - minCorner_[j])*invExtent_[j];
+      const double clipped = std::min(std::max(scaled, 0.0), 1.0);
+      ix[j] = static_cast<uint32_t>(clipped*maxCoord);
+    }
+    return hilbert_index(ix, nDim_);
+  }
+
+  // Skilling's transpose form of the Hilbert index (AIP Conf. Proc. 707, 2004)
+  static uint64_t hilbert_index(uint32_t *X, const int n)
+  {
+    const uint32_t M = 1u << (numBits_ - 1);
+
+    // inverse undo excess work
+    for ( uint32_t Q = M; Q > 1; Q >>= 1 ) {
+      const uint32_t P = Q - 1;
+      for ( int i = 0; i < n; ++i ) {
+        if ( X[i] & Q ) {
+          X[0] ^= P;
+        }
+        else {
+          const uint32_t t = (X[0] ^ X[i]) & P;
+          X[0] ^= t;
+          X[i] ^= t;
+        }
+      }
+    }
+
+    // gray encode
+    for ( int i = 1; i < n; ++i )
+      X[i] ^= X[i-1];
+    uint32_t t = 0;
+    for ( uint32_t Q = M; Q > 1; Q >>= 1 ) {
+      if ( X[n-1] & Q )
+        t ^= Q - 1;
+    }
+    for ( int i = 0; i < n; ++i )
+      X[i] ^= t;
+
+    // interleave the transposed bits, most significant first
+    uint64_t key = 0;
+    for ( int b = numBits_ - 1; b >= 0; --b ) {
+      for ( int i = 0; i < n; ++i )
+        key = (key << 1) | ((X[i] >> b) & 1u);
+    }
+    return key;
+  }
+
+  private:
+
+  const stk::mesh::Field<double> &coordinates_;
+  const int nDim_;
+  double minCorner_[3];
+  double invExtent_[3];
+};
+
+} // end sierra namespace
+} // end nalu namespace
+
+#endif
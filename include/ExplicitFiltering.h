@@ -96,6 +96,13 @@ public:
   // populate nodal field and output norms (if appropriate)
   void execute();
 
+  // flatten the node/element map into a node-to-node weight operator
+  void build_filter_operator();
+
+  // apply the operator to all user fields and fill the filter volume
+  void apply_filter_operator(
+    stk::mesh::Field<double> *explicitFilter);
+
   // general gather methods for scalar and vector (both double)
   void gather_field(
     const int &sizeOfField,
@@ -179,9 +186,20 @@ public:
   // map of point info objects to vector of element entities
   std::map<stk::mesh::Entity, std::vector<stk::mesh::Entity> > explicitFilteringMap_;
 
+  // CSR filter operator; rows are the map nodes and columns index colNodes_
+  bool operatorBuilt_;
+  size_t operatorSyncCount_;
+  std::vector<stk::mesh::Entity> rowNodes_;
+  std::vector<stk::mesh::Entity> colNodes_;
+  std::vector<size_t> rowPtr_;
+  std::vector<size_t> colIdx_;
+  std::vector<double> weights_;
+  std::vector<double> filterVolume_;
+
   // scratch space
   std::vector<double> ws_coordinates_;
   std::vector<double> ws_scv_volume_;
+  std::vector<double> ws_colValues_;
 };
 
 
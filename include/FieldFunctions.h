@@ -10,6 +10,9 @@
 
 #include <stk_mesh/base/MetaData.hpp>
 
+#include <cstddef>
+#include <map>
+
 namespace stk{
 namespace mesh{
 class FieldBase;
@@ -42,6 +45,36 @@ namespace nalu{
    The above selector would exclude aura-entities
 */
 
+// modification stamps of the fields of one realm; the realm owns them and
+// registers them on its meta data. Stamps increase across all fields, so a
+// stamp later than a reader's last evaluation means "changed"
+class FieldModificationStamps
+{
+public:
+  FieldModificationStamps();
+
+  size_t field_stamp(
+    const stk::mesh::FieldBase & field) const;
+
+  size_t current_stamp() const { return latestStamp_; }
+
+  void mark_field_modified(
+    const stk::mesh::FieldBase & field);
+
+  // state rotation, transfers and mesh changes touch fields wholesale
+  void mark_all_fields_modified();
+
+private:
+  std::map<const stk::mesh::FieldBase *, size_t> fieldStamps_;
+  size_t allFieldsStamp_;
+  size_t latestStamp_;
+};
+
+// stamp a field through the stamps registered on its meta data, if any; the
+// field functions below stamp the field they write
+void mark_field_modified(
+  const stk::mesh::FieldBase & field);
+
 // y = alpha*x + beta*y
 void field_axpby(
   const stk::mesh::MetaData & metaData,
@@ -0,0 +1,127 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef GeometryCache_h
+#define GeometryCache_h
+
+#include <ElemDataRequests.h>
+#include <KokkosInterface.h>
+#include <ScratchViews.h>
+#include <SimdInterface.h>
+
+#include <stk_mesh/base/Types.hpp>
+
+#include <cstddef>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class MasterElement;
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// GeometryCache
+//=============================================================================
+/**
+ * * @par Description:
+ * - Per element storage of the master element data (areav, grad ops, gij,
+ *   volumes) requested through ElemDataRequests, so that static meshes
+ *   evaluate the MasterElement calls once instead of in every assembly.
+ *
+ * @par Design Considerations:
+ * - Records are keyed by bucket, COORDS_TYPES, ELEM_DATA_NEEDED, master
+ *   element and fill path, and hold the SIMD interleaved views of every
+ *   element group of the bucket; algorithms requesting the same data share
+ *   the record.
+ * - Everything is dropped when the bulk data synchronized count changes;
+ *   current coordinates are never cached on a moving mesh.
+ * - Records are created serially (prepare) within a memory budget; buckets
+ *   that do not fit are computed on the fly as before.
+ * - Face based requests (FC_AREAV, face grad ops) are not cached.
+ */
+//=============================================================================
+
+class GeometryCache
+{
+public:
+
+  struct Record
+  {
+    COORDS_TYPES cType_;
+    ELEM_DATA_NEEDED data_;
+    size_t scalarsPerGroup_;
+    bool filled_;
+    AlignedViewType<DoubleType*> values_;
+  };
+
+  // the records of one bucket for one ElemDataRequests, in request order
+  struct BucketRecords
+  {
+    BucketRecords() : filled_(false) {}
+    std::vector<Record*> records_;
+    bool filled_;
+  };
+
+  explicit GeometryCache(const double memoryBudgetMB);
+  ~GeometryCache() {}
+
+  /** Resolve the records of every bucket; returns false if dataNeeded can
+   *  not be cached, in which case bucketRecords is left empty
+   */
+  bool prepare(
+    const stk::mesh::BulkData &bulkData,
+    const ElemDataRequests &dataNeeded,
+    const bool meshMoves,
+    const bool interleaved,
+    const stk::mesh::BucketVector &buckets,
+    std::vector<BucketRecords> &bucketRecords);
+
+  // mark the records written by the last assembly as valid
+  void commit(std::vector<BucketRecords> &bucketRecords);
+
+  // drop all records
+  void invalidate();
+
+  // copy the master element views of one SIMD group into/out of the cache
+  static void store(
+    const BucketRecords &bucketRecords,
+    const size_t simdGroup,
+    ScratchViews<DoubleType> &simdPrereqData);
+  static void load(
+    const BucketRecords &bucketRecords,
+    const size_t simdGroup,
+    ScratchViews<DoubleType> &simdPrereqData);
+
+  size_t bytes_used() const { return bytesUsed_; }
+
+private:
+
+  typedef std::tuple<unsigned, int, int, const MasterElement*, bool> RecordKey;
+
+  const size_t memoryBudget_;
+  size_t bytesUsed_;
+  size_t syncCount_;
+  bool budgetReported_;
+
+  std::map<RecordKey, Record> records_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -13,6 +13,7 @@
 #include <LinearSolverConfig.h>
 
 #include <LinearSolverTypes.h>
+#include <MixedPrecisionOperator.h>
 
 #include <Tpetra_Vector.hpp>
 #include <Tpetra_CrsMatrix.hpp>
@@ -161,6 +162,7 @@ class LinearSolver
   bool reusePreconditioner_;
   double timerPrecond_;
   bool activateMueLu_{false};
+  bool operatorFrozen_{false};
 
   public:
   //! Flag indicating whether the preconditioner is recomputed on each invocation
@@ -177,6 +179,9 @@ class LinearSolver
   //! Flag indicating whether the user has activated MueLU
   bool& activeMueLu() { return activateMueLu_; }
 
+  //! Flag indicating that the matrix is unchanged since the last preconditioner setup
+  bool& operatorFrozen() { return operatorFrozen_; }
+
   //! Get the solver configuration specified in the input file
   LinearSolverConfig* getConfig() { return config_; }
 };
@@ -199,26 +204,38 @@ class TpetraLinearSolver : public LinearSolver
   
     void setSystemObjects(
       Teuchos::RCP<LinSys::Matrix> matrix,
-      Teuchos::RCP<LinSys::Vector> rhs);
+      Teuchos::RCP<LinSys::MultiVector> rhs);
 
+  /** Set up the solver; sln and rhs may hold several right-hand sides that
+   *  share the matrix and preconditioner (segregated systems)
+   */
     void setupLinearSolver(
-      Teuchos::RCP<LinSys::Vector> sln,
+      Teuchos::RCP<LinSys::MultiVector> sln,
       Teuchos::RCP<LinSys::Matrix> matrix,
-      Teuchos::RCP<LinSys::Vector> rhs,
+      Teuchos::RCP<LinSys::MultiVector> rhs,
       Teuchos::RCP<LinSys::MultiVector> coords);
 
     virtual void destroyLinearSolver() override;
 
+  /** Solve with a matrix-free operator; the matrix only feeds the
+   *  preconditioner
+   */
+    void setOperator(Teuchos::RCP<LinSys::Operator> op);
+
   //! Initialize the MueLU preconditioner before solve
     void setMueLu();
 
+  //! Build the Ifpack2 or MueLu preconditioner on a float copy of the matrix
+    void setSinglePrecisionPreconditioner();
+
   /** Compute the norm of the non-linear solution vector
    *
    *  @param[in] whichNorm [0, 1, 2] norm to be computed
    *  @param[in] sln The solution vector
-   *  @param[out] norm The norm of the solution vector
+   *  @param[out] norm The norm of the solution vector; combined over all
+   *  right-hand sides
    */
-    int residual_norm(int whichNorm, Teuchos::RCP<LinSys::Vector> sln, double& norm);
+    int residual_norm(int whichNorm, Teuchos::RCP<LinSys::MultiVector> sln, double& norm);
 
   /** Solve the linear system Ax = b
    *
@@ -228,7 +245,7 @@ class TpetraLinearSolver : public LinearSolver
    *  @param[in]  isFinalOuterIter Is this the final outer iteration
    */
     int solve(
-      Teuchos::RCP<LinSys::Vector> sln,
+      Teuchos::RCP<LinSys::MultiVector> sln,
       int & iterationCount,
       double & scaledResidual,
       bool isFinalOuterIter);
@@ -242,7 +259,8 @@ class TpetraLinearSolver : public LinearSolver
   //! The preconditioner parameters
     const Teuchos::RCP<Teuchos::ParameterList> paramsPrecond_;
     Teuchos::RCP<LinSys::Matrix> matrix_;
-    Teuchos::RCP<LinSys::Vector> rhs_;
+    Teuchos::RCP<LinSys::Operator> operator_;
+    Teuchos::RCP<LinSys::MultiVector> rhs_;
     Teuchos::RCP<LinSys::LinearProblem> problem_;
     Teuchos::RCP<LinSys::SolverManager> solver_;
     Teuchos::RCP<LinSys::Preconditioner> preconditioner_;
@@ -250,6 +268,24 @@ class TpetraLinearSolver : public LinearSolver
     Teuchos::RCP<LinSys::MultiVector> coords_;
 
     std::string preconditionerType_;
+
+  //! A preconditioner has been set up for the current matrix
+    bool preconditionerReady_{false};
+
+  //! Preconditioner built and applied in float; Belos stays in double
+    bool singlePrecisionPreconditioner_{false};
+
+#ifdef HAVE_TPETRA_INST_FLOAT
+    Teuchos::RCP<LinSys::LowMatrix> lowMatrix_;
+    Teuchos::RCP<LinSys::LowMultiVector> lowCoords_;
+    Teuchos::RCP<LinSys::LowPreconditioner> lowPreconditioner_;
+    Teuchos::RCP<MueLu::TpetraOperator<float,LO,GO,NO> > lowMueluPreconditioner_;
+    Teuchos::RCP<MixedPrecisionOperator> mixedPreconditioner_;
+#endif
+
+  //! Matrix value storage of the float preconditioner is reported once
+    bool footprintReported_{false};
+    void report_preconditioner_footprint(double operatorComplexity);
 };
 
 } // namespace nalu
@@ -10,6 +10,7 @@
 #define LinearSolverTypes_h
 
 #include <KokkosInterface.h>
+#include <TpetraCore_config.h>
 #include <Tpetra_CrsGraph.hpp>
 #include <Tpetra_CrsMatrix.hpp>
 #include <Tpetra_Vector.hpp>
@@ -85,6 +86,15 @@ typedef Belos::LinearProblem<Scalar, MultiVector, Operator>                Linea
 typedef Belos::SolverManager<Scalar, MultiVector, Operator>                SolverManager;
 typedef Belos::TpetraSolverFactory<Scalar, MultiVector, Operator>          SolverFactory;
 typedef Ifpack2::Preconditioner<Scalar, LocalOrdinal, GlobalOrdinal, Node> Preconditioner;
+
+#ifdef HAVE_TPETRA_INST_FLOAT
+// single precision preconditioner storage; requires Tpetra's float instantiation
+typedef float LowScalar;
+typedef Tpetra::MultiVector<LowScalar,LocalOrdinal,GlobalOrdinal,Node>     LowMultiVector;
+typedef Tpetra::CrsMatrix<LowScalar, LocalOrdinal, GlobalOrdinal, Node>    LowMatrix;
+typedef Tpetra::Operator<LowScalar, LocalOrdinal, GlobalOrdinal, Node>     LowOperator;
+typedef Ifpack2::Preconditioner<LowScalar, LocalOrdinal, GlobalOrdinal, Node> LowPreconditioner;
+#endif
 };
 
 
@@ -48,7 +48,9 @@ public:
 
   virtual ~LinearSystem() {}
 
-  static LinearSystem *create(Realm& realm, const unsigned numDof, EquationSystem *eqSys, LinearSolver *linearSolver);
+  // segregated: one scalar matrix shared by numDof right-hand sides
+  static LinearSystem *create(Realm& realm, const unsigned numDof, EquationSystem *eqSys, LinearSolver *linearSolver,
+                              const bool segregated = false);
 
   // Graph/Matrix Construction
   virtual void buildNodeGraph(const stk::mesh::PartVector & parts)=0; // for nodal assembly (e.g., lumped mass and source)
@@ -134,6 +136,12 @@ public:
   const std::string name() { return eqSysName_; }
   bool & recomputePreconditioner() {return recomputePreconditioner_;}
   bool & reusePreconditioner() {return reusePreconditioner_;}
+  // keep the assembled matrix and its preconditioner; only the rhs is assembled
+  bool & frozenMatrix() {return frozenMatrix_;}
+  // Hex27 elements keep their sub-cell stencil only; a matrix-free operator
+  // supplies the remaining couplings (scalar Poisson systems)
+  void set_matrix_free_hex27(const bool useShiftedGradOp) {
+    matrixFreeHex27_ = true; matrixFreeShiftedGradOp_ = useShiftedGradOp; }
   double get_timer_precond();
   void zero_timer_precond();
 
@@ -161,6 +169,9 @@ protected:
   double scaledNonLinearResidual_;
   bool recomputePreconditioner_;
   bool reusePreconditioner_;
+  bool frozenMatrix_;
+  bool matrixFreeHex27_;
+  bool matrixFreeShiftedGradOp_;
 
 public:
   bool provideOutput_;
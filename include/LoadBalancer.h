@@ -0,0 +1,109 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef LoadBalancer_h
+#define LoadBalancer_h
+
+#include <FieldTypeDef.h>
+
+#include <map>
+#include <string>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+// user controls for weighted repartitioning
+struct RebalanceOptions
+{
+  RebalanceOptions()
+    : frequency_(0),
+      imbalanceThreshold_(1.1),
+      useMeasuredCost_(true),
+      decompMethod_("parmetis")
+  {}
+
+  // time step interval; zero disables rebalancing
+  int frequency_;
+
+  // max/mean of the per-rank weight; below this nothing moves
+  double imbalanceThreshold_;
+
+  // scale the part weights by the assembly time measured on each rank
+  bool useMeasuredCost_;
+
+  // Zoltan2 method used by stk_balance
+  std::string decompMethod_;
+
+  // declared cost of an element in the named part; unity otherwise
+  std::map<std::string, double> partWeights_;
+};
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// LoadBalancer
+//=============================================================================
+/**
+ * * @par Description:
+ * - Weighted element repartitioning through stk_balance. Each element
+ *   carries a weight in an element field; the graph partitioner moves
+ *   elements until the per-rank weight sums even out.
+ *
+ * @par Design Considerations:
+ * - Weights are the user part weights, optionally scaled by the measured
+ *   cost per unit weight of the owning rank. Elements on a rank that
+ *   took longer than its weight predicted become heavier, which captures
+ *   work (search, fringe, interface bands) the part weights do not.
+ * - The caller owns everything built against the old decomposition
+ *   (ghosting, linear system graph, search products, output databases)
+ *   and rebuilds it when rebalance() returns true.
+ */
+//=============================================================================
+
+class LoadBalancer
+{
+public:
+
+  LoadBalancer(
+    stk::mesh::BulkData &bulkData,
+    const RebalanceOptions &options);
+  ~LoadBalancer();
+
+  // register the element weight field (before the mesh is populated)
+  void setup();
+
+  // fill the weights; measuredCost is this rank's time since the last call
+  void compute_weights(
+    const double measuredCost);
+
+  // max/mean of the per-rank weight sums
+  double imbalance() const;
+
+  // repartition when the imbalance exceeds the threshold; true if the mesh changed
+  bool rebalance();
+
+  int num_rebalances() const { return numRebalances_; }
+
+  stk::mesh::BulkData &bulkData_;
+  const RebalanceOptions &options_;
+
+  ScalarFieldType *balanceWeight_;
+
+  int numRebalances_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
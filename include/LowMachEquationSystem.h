@@ -254,7 +254,13 @@ public:
 
   virtual void initialize();
   virtual void reinitialize_linear_system();    
+
+  // reason the operator depends on more than dt, gamma1 and mesh (empty if none)
+  std::string frozen_operator_conflict() const;
   
+  virtual void assemble_and_solve(
+    stk::mesh::FieldBase *deltaSolution);
+
   virtual void register_initial_condition_fcn(
       stk::mesh::Part *part,
       const std::map<std::string, std::string> &theNames,
@@ -276,6 +282,13 @@ public:
   AssembleNodalGradAlgorithmDriver *assembleNodalGradAlgDriver_;
   ComputeMdotAlgorithmDriver *computeMdotAlgDriver_;
   ProjectedNodalGradientEquationSystem *projectedNodalGradEqs_;
+
+  // frozen operator; the matrix is valid for this dt, gamma1 and mesh
+  bool freezeOperator_;
+  bool frozenOperatorValid_;
+  double frozenTimeStep_;
+  double frozenGamma1_;
+  size_t frozenSyncCount_;
 };
 
 } // namespace nalu
@@ -0,0 +1,102 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef MatrixFreeHex27Operator_h
+#define MatrixFreeHex27Operator_h
+
+#include <LinearSolverTypes.h>
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// MatrixFreeHex27Operator
+//=============================================================================
+/**
+ * * @par Description:
+ * - Jacobian action of a CVFEM Poisson operator on Hex27 elements without
+ *   storing the dense element couplings.
+ *
+ * @par Design Considerations:
+ * - The linear system keeps only the Hex8 sub-cell stencil of each Hex27
+ *   element (see TpetraLinearSystem::buildElemToNodeGraph); that sparse matrix
+ *   holds all boundary terms and constraints and is handed to the
+ *   preconditioner.
+ * - apply() adds, element by element, the couplings the sparse graph dropped,
+ *   recomputed on the fly from the current coordinates, so that the Krylov
+ *   solver sees the full high-order operator.
+ * - Constrained (Dirichlet, overset, reset) rows receive no correction.
+ * - Scalar systems only; the interior LHS must be -dndx.areav (continuity).
+ * - Face-element boundary algorithms (open, outflow) are not corrected;
+ *   TpetraLinearSystem::finalizeLinearSystem refuses that combination.
+ */
+//=============================================================================
+
+class MatrixFreeHex27Operator : public LinSys::Operator
+{
+public:
+
+  MatrixFreeHex27Operator(
+    Realm &realm,
+    const stk::mesh::PartVector &parts,
+    const bool useShiftedGradOp,
+    Teuchos::RCP<LinSys::Matrix> lowOrderMatrix,
+    Teuchos::RCP<LinSys::Matrix> sharedNotOwnedMatrix,
+    const std::vector<char> *constrainedOwnedRows);
+  virtual ~MatrixFreeHex27Operator() {}
+
+  Teuchos::RCP<const LinSys::Map> getDomainMap() const override;
+  Teuchos::RCP<const LinSys::Map> getRangeMap() const override;
+
+  void apply(
+    const LinSys::MultiVector &X,
+    LinSys::MultiVector &Y,
+    Teuchos::ETransp mode = Teuchos::NO_TRANS,
+    LinSys::Scalar alpha = Teuchos::ScalarTraits<LinSys::Scalar>::one(),
+    LinSys::Scalar beta = Teuchos::ScalarTraits<LinSys::Scalar>::zero()) const override;
+
+  // number of elements handled matrix free on this rank
+  size_t num_elements() const { return elements_.size(); }
+
+private:
+
+  void apply_dropped_couplings(
+    const LinSys::MultiVector &overlapX,
+    LinSys::MultiVector &overlapY) const;
+
+  Realm &realm_;
+  const bool useShiftedGradOp_;
+  Teuchos::RCP<LinSys::Matrix> lowOrderMatrix_;
+  const std::vector<char> *constrainedOwnedRows_;
+
+  // locally owned Hex27 elements, their overlap lids and dropped-coupling masks
+  std::vector<stk::mesh::Entity> elements_;
+  std::vector<LinSys::LocalOrdinal> elementLIDs_;
+  std::vector<uint32_t> droppedMask_;
+
+  Teuchos::RCP<const LinSys::Map> overlapMap_;
+  Teuchos::RCP<LinSys::Import> importer_;
+  Teuchos::RCP<LinSys::Export> exporter_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,114 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef MeshColoring_h
+#define MeshColoring_h
+
+#include <KokkosInterface.h>
+
+#include <stk_mesh/base/Selector.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// MeshColoring
+//=============================================================================
+/**
+ * * @par Description:
+ * - Greedy coloring of the elements (or edges) of a selector such that no
+ *   two entities of the same color share a node; entities of one color can
+ *   scatter into node, edge and face fields concurrently without atomics.
+ *
+ * @par Design Considerations:
+ * - Each color is stored as a list of buckets and the bucket ordinals of
+ *   that color, so colored loops keep the bucket (topology) structure of
+ *   the uncolored loops, including SIMD grouping within a bucket.
+ * - Colorings are keyed by rank and selector and dropped when the bulk
+ *   data synchronized count changes.
+ * - Entities outside the selector (e.g. aura) never constrain the coloring;
+ *   only locally selected entities are colored.
+ */
+//=============================================================================
+
+class MeshColoring
+{
+public:
+
+  // the ordinals of one bucket carrying a given color
+  struct ColoredBucket
+  {
+    stk::mesh::Bucket *bucket_;
+    std::vector<unsigned> ordinals_;
+  };
+
+  // [color][bucket]
+  typedef std::vector<std::vector<ColoredBucket> > Coloring;
+
+  MeshColoring();
+  ~MeshColoring() {}
+
+  // cached coloring of the entities of rank selected by selector
+  const Coloring & get_coloring(
+    const stk::mesh::BulkData &bulkData,
+    const stk::mesh::EntityRank rank,
+    const stk::mesh::Selector &selector);
+
+  // drop all colorings
+  void invalidate();
+
+  // greedy distance-1 (shared node) coloring of the entities in buckets
+  static void color(
+    const stk::mesh::BulkData &bulkData,
+    const stk::mesh::EntityRank rank,
+    const stk::mesh::BucketVector &buckets,
+    Coloring &coloring);
+
+private:
+
+  size_t syncCount_;
+  std::map<std::pair<stk::mesh::EntityRank, std::string>, Coloring> colorings_;
+};
+
+/** Run a team function over the colored buckets, one color at a time; the
+ *  function is called as f(team, coloredBucket) for every bucket of a color
+ */
+template<typename TeamFunction>
+void colored_bucket_loop(
+  const MeshColoring::Coloring &coloring,
+  const int bytesPerThread,
+  TeamFunction f)
+{
+  for ( const std::vector<MeshColoring::ColoredBucket> &color : coloring ) {
+    auto team_exec = get_team_policy(color.size(), 0, bytesPerThread);
+    Kokkos::parallel_for(team_exec, [&](const TeamHandleType& team)
+    {
+      f(team, color[team.league_rank()]);
+    });
+  }
+}
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,77 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef MixedPrecisionOperator_h
+#define MixedPrecisionOperator_h
+
+#include <LinearSolverTypes.h>
+
+#ifdef HAVE_TPETRA_INST_FLOAT
+
+#include <Teuchos_RCP.hpp>
+#include <Tpetra_Operator.hpp>
+
+namespace sierra{
+namespace nalu{
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// MixedPrecisionOperator
+//=============================================================================
+/**
+ * * @par Description:
+ * - Double precision view of a single precision operator, e.g., an Ifpack2
+ *   or MueLu preconditioner built on a float copy of the matrix. The Krylov
+ *   iteration stays in double; only the preconditioner apply runs in float.
+ *
+ * @par Design Considerations:
+ * - The maps do not depend on the scalar type and are shared with the
+ *   wrapped operator.
+ * - The float work vectors are kept between applies and only reallocated
+ *   when the number of vectors changes.
+ */
+//=============================================================================
+
+class MixedPrecisionOperator : public LinSys::Operator
+{
+public:
+
+  MixedPrecisionOperator(
+    Teuchos::RCP<LinSys::LowOperator> lowOperator);
+  virtual ~MixedPrecisionOperator();
+
+  virtual Teuchos::RCP<const LinSys::Map> getDomainMap() const override;
+  virtual Teuchos::RCP<const LinSys::Map> getRangeMap() const override;
+
+  // Y = beta*Y + alpha*Op(X), with Op applied in single precision
+  virtual void apply(
+    const LinSys::MultiVector &X,
+    LinSys::MultiVector &Y,
+    Teuchos::ETransp mode = Teuchos::NO_TRANS,
+    LinSys::Scalar alpha = Teuchos::ScalarTraits<LinSys::Scalar>::one(),
+    LinSys::Scalar beta = Teuchos::ScalarTraits<LinSys::Scalar>::zero()) const override;
+
+  virtual bool hasTransposeApply() const override;
+
+private:
+
+  Teuchos::RCP<LinSys::LowOperator> lowOperator_;
+
+  // float work vectors; the apply is const
+  mutable Teuchos::RCP<LinSys::LowMultiVector> lowX_;
+  mutable Teuchos::RCP<LinSys::LowMultiVector> lowY_;
+  mutable Teuchos::RCP<LinSys::MultiVector> scaledY_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
+
+#endif
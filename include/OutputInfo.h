@@ -13,6 +13,7 @@
 
 #include <string>
 #include <set>
+#include <vector>
 
 namespace Ioss{
   class PropertyManager;
@@ -21,6 +22,14 @@ namespace Ioss{
 namespace sierra{
 namespace nalu{
 
+// error bound for one field of the compressed output
+struct CompressedFieldSpec
+{
+  std::string fieldName_;
+  double absoluteError_{0.0};
+  double relativeError_{0.0};
+};
+
 class OutputInfo
 {
 public:
@@ -47,6 +56,7 @@ public:
   int outputStart_;
   bool outputNodeSet_; 
   int serializedIOGroupSize_;
+  bool outputAsynchronous_;
   bool hasOutputBlock_;
   bool hasRestartBlock_;
   bool activateRestart_;
@@ -55,6 +65,7 @@ public:
   int restartFreq_;
   int restartStart_;
   int restartMaxDataBaseStepSize_;
+  bool restartAsynchronous_;
   bool restartNodeSet_;
   bool restartResetTime_;
   double restartResetNewTime_;
@@ -70,6 +81,13 @@ public:
   Ioss::PropertyManager *outputPropertyManager_;
   Ioss::PropertyManager *restartPropertyManager_;
 
+  // error-bounded lossy output of node fields
+  bool hasCompressedOutput_;
+  std::string compressedDBName_;
+  int compressedFreq_;
+  int compressedStart_;
+  std::vector<CompressedFieldSpec> compressedFieldSpecs_;
+
   std::set<std::string> outputFieldNameSet_;
   std::set<std::string> restartFieldNameSet_;
 
@@ -0,0 +1,77 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ParallelFieldExchange_h
+#define ParallelFieldExchange_h
+
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// ParallelFieldExchange
+//=============================================================================
+/**
+ * * @par Description:
+ * - Collect the nodal fields that an algorithm driver assembles and complete
+ *   the shared-node sum and the periodic monarch/subject update for all of
+ *   them together.
+ *
+ * @par Design Considerations:
+ * - stk packs every field of a parallel_sum into a single message per
+ *   neighbor, so the number of messages no longer grows with the number of
+ *   fields; the same holds for each stage of the periodic update.
+ * - The exchange is blocking. complete() must be called before the summed
+ *   fields are read.
+ */
+//=============================================================================
+
+class ParallelFieldExchange
+{
+public:
+
+  explicit ParallelFieldExchange(Realm &realm);
+  ~ParallelFieldExchange() {}
+
+  // register a field for the shared-node sum and, when active, periodic assembly
+  void add_parallel_sum(
+    stk::mesh::FieldBase *theField,
+    const unsigned sizeOfField,
+    const bool bypassFieldCheck = true);
+
+  // exchange all registered fields and reset
+  void complete();
+
+  bool empty() const { return sumFields_.empty(); }
+
+private:
+
+  Realm &realm_;
+
+  std::vector<const stk::mesh::FieldBase *> sumFields_;
+
+  // periodic updates are grouped by the field check option
+  std::vector<stk::mesh::FieldBase *> periodicFields_[2];
+  std::vector<unsigned> periodicSizes_[2];
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -65,6 +65,14 @@ class PeriodicManager {
     const bool addSubjects,
     const bool setSubjects);
 
+  // same for a set of fields; every exchange carries all fields at once
+  void apply_constraints(
+    const std::vector<stk::mesh::FieldBase *> &fieldVec,
+    const std::vector<unsigned> &sizeOfFieldVec,
+    const bool bypassFieldCheck,
+    const bool addSubjects,
+    const bool setSubjects);
+
   // find the max
   void apply_max_field(
     stk::mesh::FieldBase *,
@@ -109,11 +117,19 @@ class PeriodicManager {
   periodic_parallel_communicate_field(
     stk::mesh::FieldBase *theField);
 
+  void
+  periodic_parallel_communicate_fields(
+    const std::vector<const stk::mesh::FieldBase *> &fieldVec);
+
   /* communicate shared nodes and aura nodes */
   void
   parallel_communicate_field(
     stk::mesh::FieldBase *theField);
 
+  void
+  parallel_communicate_fields(
+    const std::vector<const stk::mesh::FieldBase *> &fieldVec);
+
   Realm &realm_;
 
   /* manage tolerances; each block specifies a user tolerance */
@@ -158,13 +174,13 @@ class PeriodicManager {
   SearchKeyVector searchKeyVector_;
 
   void add_subject_to_monarch(
-    stk::mesh::FieldBase *theField,
-    const unsigned &sizeOfField,
+    const std::vector<stk::mesh::FieldBase *> &fieldVec,
+    const std::vector<unsigned> &sizeOfFieldVec,
     const bool &bypassFieldCheck);
 
   void set_subject_to_monarch(
-    stk::mesh::FieldBase *theField,
-    const unsigned &sizeOfField,
+    const std::vector<stk::mesh::FieldBase *> &fieldVec,
+    const std::vector<unsigned> &sizeOfFieldVec,
     const bool &bypassFieldCheck);
 
 };
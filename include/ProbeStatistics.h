@@ -0,0 +1,110 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ProbeStatistics_h
+#define ProbeStatistics_h
+
+#include <complex>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// ProbeStatistics
+//=============================================================================
+/**
+ * * @par Description:
+ * - Streaming statistics of one scalar signal sampled on a structured
+ *   numPointsOne x numPointsTwo probe (a line has numPointsTwo = 1); point p
+ *   sits at (p % numPointsOne, p / numPointsOne).
+ * - Plane-averaged one-sided power spectral density by Welch's method (Hann
+ *   window, constant detrend, overlapping segments of windowLength samples).
+ * - Two-point covariance versus separation along either probe direction.
+ * - Time-lagged auto-covariance, averaged over the probe points.
+ *
+ * @par Design Considerations:
+ * - Only a history of max(windowLength, maxTimeLag+1) samples per point is
+ *   kept; everything else is accumulated in O(points) or O(separations).
+ * - Covariances subtract the per-point time mean at the time of the query.
+ * - A fixed sample interval is assumed for the spectra; the mean interval
+ *   over all samples defines the frequency axis.
+ */
+//=============================================================================
+
+class ProbeStatistics
+{
+public:
+
+  ProbeStatistics(
+    const int numPointsOne,
+    const int numPointsTwo,
+    const int windowLength,
+    const int windowOverlap,
+    const int maxTimeLag,
+    const int maxSeparation);
+
+  // add one sample; values[p*stride] is the signal at point p
+  void add_sample(const double *values, const int stride, const double sampleInterval);
+
+  // one-sided psd averaged over points and segments; frequencies in 1/time
+  void compute_psd(std::vector<double> &frequency, std::vector<double> &psd) const;
+
+  // covariance versus separation index along direction 0 (one) or 1 (two)
+  void compute_two_point_covariance(const int direction, std::vector<double> &covariance) const;
+
+  // auto-covariance versus lag index
+  void compute_time_lag_covariance(std::vector<double> &covariance) const;
+
+  int num_samples() const { return numSamples_; }
+  int num_segments() const { return numSegments_; }
+  double mean_sample_interval() const { return numSamples_ > 0 ? totalTime_/numSamples_ : 0.0; }
+
+  // in-place radix-2 transform; size must be a power of two
+  static void fft(std::vector<std::complex<double> > &data);
+
+private:
+
+  void process_segment();
+
+  // sample at point p taken "age" samples ago (age 0 is the newest)
+  double history(const int p, const int age) const {
+    return history_[p*historyLength_ + (numSamples_ - 1 - age) % historyLength_];
+  }
+
+  const int numPointsOne_;
+  const int numPointsTwo_;
+  const int numPoints_;
+  const int windowLength_;
+  const int hopLength_;
+  const int maxTimeLag_;
+  const int maxSeparation_[2];
+  const int historyLength_;
+
+  int numSamples_;
+  int numSegments_;
+  double totalTime_;
+
+  std::vector<double> history_;
+  std::vector<double> window_;
+  double windowPower_;
+  std::vector<std::complex<double> > scratch_;
+
+  std::vector<double> psdSum_;
+  std::vector<double> pointSum_;
+  std::vector<double> separationSum_[2];
+  std::vector<double> lagSum_;
+  std::vector<double> lagCount_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -11,6 +11,7 @@
 
 #include <Enums.h>
 #include <FieldTypeDef.h>
+#include <FieldFunctions.h>
 
 // yaml for parsing..
 #include <yaml-cpp/yaml.h>
@@ -22,6 +23,9 @@
 #include <Teuchos_RCP.hpp>
 #include <overset/OversetManager.h>
 #include <MeshMotionInfo.h>
+#include <BucketCache.h>
+#include <LoadBalancer.h>
+#include <MeshColoring.h>
 
 #include <stk_util/util/ParameterList.hpp>
 
@@ -71,6 +75,10 @@ class TurbulenceAveragingPostProcessing;
 class DataProbePostProcessing;
 class Actuator;
 class ExplicitFiltering;
+class AsyncOutputWriter;
+class CompressedOutputWriter;
+class GeometryCache;
+class ReductionService;
 
 /** Representation of a computational domain and physics equations solved on
  * this domain.
@@ -123,6 +131,11 @@ class Realm {
 
   void balance_nodes();
 
+  // weighted repartitioning; rebuilds everything tied to the decomposition
+  void setup_load_balancer();
+  void rebalance_mesh();
+  void reopen_output_databases();
+
   void create_output_mesh();
   void create_restart_mesh();
   void input_variables_from_mesh();
@@ -135,6 +148,8 @@ class Realm {
 
   void create_edges();
   void provide_entity_count();
+  void reorder_mesh_entities();
+  void provide_locality_report(const std::string &stage);
   void delete_edges();
   void commit();
 
@@ -236,6 +251,12 @@ class Realm {
   void output_converged_results();
   void provide_output();
   void provide_restart_output();
+  void provide_compressed_output();
+  void flush_output();
+
+  // broker that owns the results/restart database (the writer's when asynchronous)
+  stk::io::StkMeshIoBroker *results_io_broker();
+  stk::io::StkMeshIoBroker *restart_io_broker();
 
   void register_interior_algorithm(
     stk::mesh::Part *part);
@@ -284,6 +305,14 @@ class Realm {
     const bool addSubject = true,
     const bool setSubjects = true) const;
 
+  // periodic update of a set of fields with one exchange per stage
+  void periodic_field_update(
+    const std::vector<stk::mesh::FieldBase *> &fieldVec,
+    const std::vector<unsigned> &sizeOfFieldVec,
+    const bool bypassFieldCheck = true,
+    const bool addSubject = true,
+    const bool setSubjects = true) const;
+
   void periodic_delta_solution_update(
      stk::mesh::FieldBase *theField,
      const unsigned &sizeOfField) const;
@@ -307,6 +336,8 @@ class Realm {
   virtual double populate_restart( double &timeStepNm1, int &timeStepCount);
   virtual void populate_derived_quantities();
   virtual void evaluate_properties();
+  void execute_property_algorithms(
+    const std::vector<Algorithm *> &algVec);
   virtual double compute_adaptive_time_step();
   virtual void swap_states();
   virtual void predict_state();
@@ -397,6 +428,20 @@ class Realm {
     stk::mesh::EntityRank rank,
     const stk::mesh::Selector & selector) const;
 
+  // cached buckets with per-bucket entity and SIMD group counts
+  const BucketCache::BucketList & get_bucket_list(
+    stk::mesh::EntityRank rank,
+    const stk::mesh::Selector & selector) const;
+
+  // race-free coloring of the selected entities; recomputed after mesh modification
+  const MeshColoring::Coloring & get_coloring(
+    stk::mesh::EntityRank rank,
+    const stk::mesh::Selector & selector);
+
+  // fused non-blocking global reductions of diagnostics; started once per
+  // phase, consumers of the reduced values call finish()
+  ReductionService & reduction_service();
+
   // get aura, bulk and meta data
   bool get_activate_aura();
   stk::mesh::BulkData & bulk_data();
@@ -471,6 +516,14 @@ class Realm {
   DataProbePostProcessing *dataProbePostProcessing_;
   Actuator *actuator_;
   ExplicitFiltering *explicitFiltering_;
+  AsyncOutputWriter *asyncOutputWriter_;
+  AsyncOutputWriter *asyncRestartWriter_;
+  CompressedOutputWriter *compressedOutputWriter_;
+  GeometryCache *geometryCache_;
+  BucketCache *bucketCache_;
+  MeshColoring *meshColoring_;
+  ReductionService *reductionService_;
+  LoadBalancer *loadBalancer_;
 
   std::vector<Algorithm *> propertyAlg_;
   std::map<PropertyIdentifier, ScalarFieldType *> propertyMap_;
@@ -487,11 +540,18 @@ class Realm {
   double timerNonconformal_;
   double timerInitializeEqs_;
   double timerPropertyEval_;
+  size_t numPropertyAlgExecuted_;
+  size_t numPropertyAlgSkipped_;
+
+  // modification stamps of this realm's fields; registered on the meta data
+  // so that the field functions stamp what they write
+  FieldModificationStamps fieldStamps_;
   double timerAdapt_;
   double timerTransferSearch_;
   double timerTransferExecute_;
   double timerSkinMesh_;
   double timerSortExposedFace_;
+  double timerReorderMesh_;
 
   NonConformalManager *nonConformalManager_;
   OversetManager *oversetManager_;
@@ -503,6 +563,8 @@ class Realm {
   bool hasInitializationTransfer_;
   bool hasIoTransfer_;
   bool hasExternalDataTransfer_;
+  // source or target of a transfer that searches during the run
+  bool hasRunTimeTransfer_;
 
   PeriodicManager *periodicManager_;
   bool hasPeriodic_;
@@ -537,6 +599,9 @@ class Realm {
   // automatic mesh decomposition; None, rib, rcb, multikl, etc.
   std::string autoDecompType_;
 
+  // cache-aware bucket ordering; None or hilbert
+  std::string meshReorderingType_;
+
   // allow aura to be optional
   bool activateAura_;
 
@@ -559,6 +624,14 @@ class Realm {
   };
   BalanceNodeOptions balanceNodeOptions_;
 
+  // weighted repartitioning during the run
+  RebalanceOptions rebalanceOptions_;
+  double rebalanceCostMark_;
+  double timerRebalance_;
+  std::string outputDBBaseName_;
+  std::string restartDBBaseName_;
+  std::string compressedDBBaseName_;
+
   // beginning wall time
   double wallTimeStart_;
 
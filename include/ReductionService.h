@@ -0,0 +1,108 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ReductionService_h
+#define ReductionService_h
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// ReductionService
+//=============================================================================
+/**
+ * * @par Description:
+ * - Collects the small global sum/max/min reductions of diagnostics and
+ *   norms and completes all of them with a single non-blocking collective.
+ *
+ * @par Design Considerations:
+ * - Each value travels with its operation, so one MPI_Iallreduce with a
+ *   user-defined operation serves sums, maxima and minima alike.
+ * - Callbacks run in registration order when the reduction completes, with
+ *   the reduced buffer indexed by the offsets returned from add().
+ * - start() launches what has been queued so far; the reduction then
+ *   overlaps with whatever the caller does next until finish() (or the next
+ *   start()) waits on it. Consumers of reduced values call finish(), which
+ *   also reduces anything queued but not yet started.
+ * - Sums are exact for integer-valued contributions; otherwise they agree
+ *   with separate reductions up to the order of summation.
+ */
+//=============================================================================
+
+class ReductionService
+{
+public:
+
+  enum Operation {
+    SUM = 0,
+    MAX = 1,
+    MIN = 2
+  };
+
+  typedef std::function<void(const std::vector<double> &)> Callback;
+
+  explicit ReductionService(MPI_Comm comm);
+  ~ReductionService();
+
+  // queue n local values reduced with op; returns their offset in the
+  // reduced buffer handed to the callbacks
+  size_t add(
+    const Operation op,
+    const double *values,
+    const int n);
+
+  // run callback on the reduced buffer once the queued values are reduced
+  void add_callback(const Callback &callback);
+
+  // launch the reduction of everything queued; completes a pending one first
+  void start();
+
+  // complete the pending reduction and anything queued since, running
+  // the callbacks in registration order
+  void finish();
+
+  // blocking reduction of everything queued
+  void reduce();
+
+  size_t num_collectives() const { return numCollectives_; }
+
+private:
+
+  void launch();
+  void complete();
+
+  MPI_Comm comm_;
+  MPI_Datatype valueOpType_;
+  MPI_Op fusedOp_;
+
+  // queued: (value, operation) pairs and their callbacks
+  std::vector<double> queued_;
+  std::vector<Callback> queuedCallbacks_;
+
+  // in flight
+  bool pending_;
+  MPI_Request request_;
+  std::vector<double> sendBuffer_;
+  std::vector<double> recvBuffer_;
+  std::vector<Callback> pendingCallbacks_;
+
+  size_t numCollectives_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
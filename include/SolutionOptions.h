@@ -137,6 +137,13 @@ public:
   bool consistentMMPngDefault_;
   bool useConsolidatedSolverAlg_;
   bool useConsolidatedBcSolverAlg_;
+  bool segregatedMomentum_;
+  bool freezeContinuityOperator_;
+  bool matrixFreeHex27Continuity_;
+  bool cacheElementGeometry_;
+  double elementGeometryCacheBudget_;
+  bool useElementColoring_;
+  bool lazyPropertyEvaluation_;
   bool eigenvaluePerturb_;
   double eigenvaluePerturbDelta_;
   int eigenvaluePerturbBiasTowards_;
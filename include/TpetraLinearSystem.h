@@ -57,11 +57,17 @@ public:
   typedef LinSys::GlobalOrdinal GlobalOrdinal;
   typedef LinSys::LocalOrdinal  LocalOrdinal;
 
+  /** A segregated system assembles the usual numDof block contributions but
+   *  stores one scalar matrix (the mean of the diagonal component blocks)
+   *  and numDof right-hand sides that share the matrix and preconditioner;
+   *  the component coupling is dropped from the LHS, not from the residual.
+   */
   TpetraLinearSystem(
     Realm &realm,
     const unsigned numDof,
     EquationSystem *eqSys,
-    LinearSolver * linearSolver);
+    LinearSolver * linearSolver,
+    const bool segregated = false);
   ~TpetraLinearSystem();
 
    // Graph/Matrix Construction
@@ -135,8 +141,10 @@ public:
 
   Teuchos::RCP<LinSys::Graph>  getOwnedGraph() { return ownedGraph_; }
   Teuchos::RCP<LinSys::Matrix> getOwnedMatrix() { return ownedMatrix_; }
+  Teuchos::RCP<LinSys::Operator> getMatrixFreeOperator() { return matrixFreeOperator_; }
 
 private:
+  void buildHex27SubcellGraph(const stk::mesh::PartVector & parts);
   void buildConnectedNodeGraph(stk::mesh::EntityRank rank,
                                const stk::mesh::PartVector& parts);
 
@@ -164,9 +172,22 @@ private:
   void fill_entity_to_col_LID_mapping();
 
   void copy_tpetra_to_stk(
-    const Teuchos::RCP<LinSys::Vector> tpetraVector,
+    const Teuchos::RCP<LinSys::MultiVector> tpetraVector,
     stk::mesh::FieldBase * stkField);
 
+  void sumIntoSegregated(
+    const unsigned numEntities,
+    const stk::mesh::Entity* entities,
+    const double* rhs,
+    const double* lhs,
+    int* localIds,
+    int* sortPermutation);
+
+  void checkSegregatedRange(
+    const unsigned beginPos,
+    const unsigned endPos,
+    const char *method) const;
+
   // This method copies a stk::mesh::field to a tpetra multivector. Each dof/node is written into a different
   // vector in the multivector.
   void copy_stk_to_tpetra(stk::mesh::FieldBase * stkField,
@@ -198,17 +219,16 @@ private:
   Teuchos::RCP<LinSys::Graph>  sharedNotOwnedGraph_;
 
   Teuchos::RCP<LinSys::Matrix> ownedMatrix_;
-  Teuchos::RCP<LinSys::Vector> ownedRhs_;
+  Teuchos::RCP<LinSys::MultiVector> ownedRhs_;
   LinSys::Matrix::local_matrix_host_type ownedLocalMatrix_;
   LinSys::Matrix::local_matrix_host_type sharedNotOwnedLocalMatrix_;
   host_view_type ownedLocalRhs_;
   host_view_type sharedNotOwnedLocalRhs_;
 
   Teuchos::RCP<LinSys::Matrix> sharedNotOwnedMatrix_;
-  Teuchos::RCP<LinSys::Vector> sharedNotOwnedRhs_;
+  Teuchos::RCP<LinSys::MultiVector> sharedNotOwnedRhs_;
 
-  Teuchos::RCP<LinSys::Vector> sln_;
-  Teuchos::RCP<LinSys::Vector> globalSln_;
+  Teuchos::RCP<LinSys::MultiVector> sln_;
   Teuchos::RCP<LinSys::Export> exporter_;
 
   MyLIDMapType myLIDs_;
@@ -218,6 +238,18 @@ private:
   LocalOrdinal maxSharedNotOwnedRowId_; // = (num_owned_nodes + num_sharedNotOwned_nodes) * numDof_
 
   std::vector<int> sortPermutation_;
+
+  // matrix-free Hex27: parts on sub-cell stencils, operator and constrained owned rows
+  stk::mesh::PartVector matrixFreeParts_;
+  Teuchos::RCP<LinSys::Operator> matrixFreeOperator_;
+  std::vector<char> constrainedOwnedRows_;
+  // parts with face-element algorithms; rejected by the matrix-free Hex27 operator
+  stk::mesh::PartVector faceElemParts_;
+
+  // segregated: scalar matrix rows per node and one rhs per dof
+  const bool segregated_;
+  const unsigned numMatrixDof_;
+  const unsigned numRhs_;
 };
 
 int getDofStatus_impl(stk::mesh::Entity node, const Realm& realm);
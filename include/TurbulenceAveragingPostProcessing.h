@@ -92,49 +92,9 @@ public:
   // populate nodal field and output norms (if appropriate)
   void execute();
 
-  // compute tke and stress for each type of operation
-  void compute_tke(
-    const bool isReynolds,
-    const std::string &averageBlockName,
-    stk::mesh::Selector s_all_nodes);
-
-  void compute_reynolds_stress(
-    const std::string &averageBlockName,
-    const double &oldTimeFilter,
-    const double &zeroCurrent,
-    const double &dt,
-    stk::mesh::Selector s_all_nodes);
-
-  void compute_favre_stress(
-    const std::string &averageBlockName,
-    const double &oldTimeFilter,
-    const double &zeroCurrent,
-    const double &dt,
-    stk::mesh::Selector s_all_nodes);
-
-  void compute_resolved_stress(
-      const std::string &averageBlockName,
-      const double &oldTimeFilter,
-      const double &zeroCurrent,
-      const double &dt,
-      stk::mesh::Selector s_all_nodes);
-
-  void compute_sfs_stress(
-      const std::string &averageBlockName,
-      const double &oldTimeFilter,
-      const double &zeroCurrent,
-      const double &dt,
-      stk::mesh::Selector s_all_nodes);
-
-  void compute_temperature_resolved_flux(
-    const std::string &averageBlockName,
-    const double &oldTimeFilter,
-    const double &zeroCurrent,
-    const double &dt,
-    stk::mesh::Selector s_all_nodes);
-
-  void compute_temperature_sfs_flux(
-    const std::string &averageBlockName,
+  // update all averages and node-local statistics in one bucket-level pass
+  void execute_fused_node_pass(
+    const AveragingInfo *avInfo,
     const double &oldTimeFilter,
     const double &zeroCurrent,
     const double &dt,
@@ -0,0 +1,295 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+#ifndef FusedKernel_h
+#define FusedKernel_h
+
+#include <kernel/Kernel.h>
+#include <AlgTraits.h>
+
+#include <stk_topology/topology.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Detects kernels that expose a per scv integration point body
+ *
+ * Such kernels provide a ScvIpViews type, bind_scv_ip_views() and an inline
+ * scv_ip_execute(); their integration point loops can then be merged.
+ */
+template<typename KernelType, typename = void>
+struct HasScvIpBody : std::false_type {};
+
+template<typename KernelType>
+struct HasScvIpBody<KernelType, decltype(void(&KernelType::scv_ip_execute))>
+  : std::true_type {};
+
+/** Statically bound calls into one kernel of a fused stack
+ *
+ * Kernels without a per-ip body run their own execute; kernels with one are
+ * skipped there and run inside the shared scv integration point loop.
+ */
+template<typename KernelType, bool = HasScvIpBody<KernelType>::value>
+struct FusedKernelCalls
+{
+  static const int numScvIpBodies_ = 0;
+
+  struct ScvIpViews {};
+
+  static ScvIpViews bind(const KernelType*, ScratchViews<DoubleType>&) { return ScvIpViews(); }
+
+  static void scv_ip_execute(
+    const KernelType*, const int, const ScvIpViews&,
+    SharedMemView<DoubleType**>&, SharedMemView<DoubleType*>&) {}
+
+  static void execute(
+    KernelType* kernel,
+    SharedMemView<DoubleType**>& lhs,
+    SharedMemView<DoubleType*>& rhs,
+    ScratchViews<DoubleType>& scratchViews)
+  {
+    kernel->KernelType::execute(lhs, rhs, scratchViews);
+  }
+};
+
+template<typename KernelType>
+struct FusedKernelCalls<KernelType, true>
+{
+  static const int numScvIpBodies_ = 1;
+
+  typedef typename KernelType::ScvIpViews ScvIpViews;
+
+  static ScvIpViews bind(const KernelType* kernel, ScratchViews<DoubleType>& scratchViews)
+  {
+    return kernel->bind_scv_ip_views(scratchViews);
+  }
+
+  static void scv_ip_execute(
+    const KernelType* kernel, const int ip, const ScvIpViews& views,
+    SharedMemView<DoubleType**>& lhs, SharedMemView<DoubleType*>& rhs)
+  {
+    kernel->scv_ip_execute(ip, views, lhs, rhs);
+  }
+
+  static void execute(
+    KernelType*,
+    SharedMemView<DoubleType**>&,
+    SharedMemView<DoubleType*>&,
+    ScratchViews<DoubleType>&) {}
+};
+
+/** Recursive holder for a compile-time stack of kernels
+ *
+ * Every call is bound to the concrete kernel type, so the stack costs no
+ * virtual dispatch beyond the one into FusedKernel.
+ */
+template<typename AlgTraits, template <typename> class... Ks>
+struct KernelStack
+{
+  static const int numScvIpBodies_ = 0;
+
+  struct ScvIpViews
+  {
+    ScvIpViews(const KernelStack&, ScratchViews<DoubleType>&) {}
+  };
+
+  explicit KernelStack(std::vector<Kernel*>::const_iterator) {}
+  static bool matches(std::vector<Kernel*>::const_iterator) { return true; }
+  void destroy() {}
+  void setup(const TimeIntegrator&) {}
+  void scv_ip_execute(
+    const int,
+    const ScvIpViews&,
+    SharedMemView<DoubleType**>&,
+    SharedMemView<DoubleType*>&) const {}
+  void execute(
+    SharedMemView<DoubleType**>&,
+    SharedMemView<DoubleType*>&,
+    ScratchViews<DoubleType>&) {}
+};
+
+template<typename AlgTraits, template <typename> class K, template <typename> class... Ks>
+struct KernelStack<AlgTraits, K, Ks...>
+{
+  typedef K<AlgTraits> KernelType;
+  typedef FusedKernelCalls<KernelType> Calls;
+  typedef KernelStack<AlgTraits, Ks...> RestType;
+
+  static const int numScvIpBodies_ = Calls::numScvIpBodies_ + RestType::numScvIpBodies_;
+
+  // per-element views of every kernel with a per-ip body, bound once
+  struct ScvIpViews
+  {
+    ScvIpViews(const KernelStack& stack, ScratchViews<DoubleType>& scratchViews)
+      : kernel_(Calls::bind(stack.kernel_, scratchViews)),
+        rest_(stack.rest_, scratchViews)
+    {}
+
+    typename Calls::ScvIpViews kernel_;
+    typename RestType::ScvIpViews rest_;
+  };
+
+  explicit KernelStack(std::vector<Kernel*>::const_iterator it)
+    : kernel_(static_cast<KernelType*>(*it)),
+      rest_(it + 1)
+  {}
+
+  // true if the kernels starting at it have the dynamic types of the stack
+  static bool matches(std::vector<Kernel*>::const_iterator it)
+  {
+    return dynamic_cast<KernelType*>(*it) != nullptr
+      && RestType::matches(it + 1);
+  }
+
+  void destroy()
+  {
+    delete kernel_;
+    rest_.destroy();
+  }
+
+  void setup(const TimeIntegrator& timeIntegrator)
+  {
+    kernel_->KernelType::setup(timeIntegrator);
+    rest_.setup(timeIntegrator);
+  }
+
+  // one integration point of every per-ip body, in stack order
+  void scv_ip_execute(
+    const int ip,
+    const ScvIpViews& views,
+    SharedMemView<DoubleType**>& lhs,
+    SharedMemView<DoubleType*>& rhs) const
+  {
+    Calls::scv_ip_execute(kernel_, ip, views.kernel_, lhs, rhs);
+    rest_.scv_ip_execute(ip, views.rest_, lhs, rhs);
+  }
+
+  // kernels without a per-ip body, in stack order
+  void execute(
+    SharedMemView<DoubleType**>& lhs,
+    SharedMemView<DoubleType*>& rhs,
+    ScratchViews<DoubleType>& scratchViews)
+  {
+    Calls::execute(kernel_, lhs, rhs, scratchViews);
+    rest_.execute(lhs, rhs, scratchViews);
+  }
+
+  KernelType* kernel_;
+  RestType rest_;
+};
+
+/** Compile-time composition of a stack of element kernels
+ *
+ * The kernels are owned through their concrete types, so the whole stack
+ * costs one virtual dispatch per SIMD element group. Kernels with a per scv
+ * integration point body (see HasScvIpBody) share a single inlined loop over
+ * the scv ips, reading the gathered views and the rhs/lhs rows of an ip
+ * while they are in cache; the remaining kernels then run in stack order.
+ * Contributions of the per-ip kernels are therefore summed before those of
+ * the others, which changes the result only at round-off.
+ */
+template<typename AlgTraits, template <typename> class... Ks>
+class FusedKernel : public Kernel
+{
+public:
+  typedef KernelStack<AlgTraits, Ks...> StackType;
+
+  static const std::size_t numKernels_ = sizeof...(Ks);
+
+  // takes ownership of the numKernels_ kernels starting at first
+  explicit FusedKernel(std::vector<Kernel*>::const_iterator first)
+    : stack_(first)
+  {}
+
+  virtual ~FusedKernel()
+  {
+    stack_.destroy();
+  }
+
+  virtual void setup(const TimeIntegrator& timeIntegrator)
+  {
+    stack_.setup(timeIntegrator);
+  }
+
+  // the face-element overload is not fused
+  using Kernel::execute;
+
+  virtual void execute(
+    SharedMemView<DoubleType**>& lhs,
+    SharedMemView<DoubleType*>& rhs,
+    ScratchViews<DoubleType>& scratchViews)
+  {
+    if ( StackType::numScvIpBodies_ > 0 ) {
+      const typename StackType::ScvIpViews views(stack_, scratchViews);
+      for ( int ip = 0; ip < AlgTraits::numScvIp_; ++ip )
+        stack_.scv_ip_execute(ip, views, lhs, rhs);
+    }
+    stack_.execute(lhs, rhs, scratchViews);
+  }
+
+  /** Replace the first contiguous run of kernels in kernelVec whose dynamic
+   *  types match Ks<AlgTraits>... by one fused kernel; returns false, and
+   *  leaves kernelVec untouched, if there is no such run
+   */
+  static bool fuse(std::vector<Kernel*>& kernelVec)
+  {
+    for ( std::size_t k = 0; k + numKernels_ <= kernelVec.size(); ++k ) {
+      const std::vector<Kernel*>::const_iterator first = kernelVec.begin() + k;
+      if ( !StackType::matches(first) )
+        continue;
+
+      Kernel* fused = new FusedKernel(first);
+      kernelVec.erase(kernelVec.begin() + k, kernelVec.begin() + k + numKernels_);
+      kernelVec.insert(kernelVec.begin() + k, fused);
+      return true;
+    }
+    return false;
+  }
+
+private:
+  StackType stack_;
+};
+
+/** Topology dispatch for FusedKernel<AlgTraits, Ks...>::fuse
+ *
+ * Equation systems call this after the requested kernels are built to fold
+ * a commonly used stack into one fused kernel; any other combination keeps
+ * the generic per-kernel loop of AssembleElemSolverAlgorithm.
+ */
+template <template <typename> class... Ks>
+bool fuse_topo_kernels(int /* dimension */, stk::topology topo, std::vector<Kernel*>& kernelVec)
+{
+  switch(topo.value()) {
+  case stk::topology::HEX_8:
+    return FusedKernel<AlgTraitsHex8, Ks...>::fuse(kernelVec);
+  case stk::topology::HEX_27:
+    return FusedKernel<AlgTraitsHex27, Ks...>::fuse(kernelVec);
+  case stk::topology::TET_4:
+    return FusedKernel<AlgTraitsTet4, Ks...>::fuse(kernelVec);
+  case stk::topology::PYRAMID_5:
+    return FusedKernel<AlgTraitsPyr5, Ks...>::fuse(kernelVec);
+  case stk::topology::WEDGE_6:
+    return FusedKernel<AlgTraitsWed6, Ks...>::fuse(kernelVec);
+  case stk::topology::QUAD_4_2D:
+    return FusedKernel<AlgTraitsQuad4_2D, Ks...>::fuse(kernelVec);
+  case stk::topology::QUAD_9_2D:
+    return FusedKernel<AlgTraitsQuad9_2D, Ks...>::fuse(kernelVec);
+  case stk::topology::TRI_3_2D:
+    return FusedKernel<AlgTraitsTri3_2D, Ks...>::fuse(kernelVec);
+  default:
+    return false;
+  }
+}
+
+}  // nalu
+}  // sierra
+
+#endif /* FusedKernel_h */
@@ -44,6 +44,24 @@ public:
     SharedMemView<DoubleType*>&,
     ScratchViews<DoubleType>&);
 
+  /// Gathered views used at each scv integration point (see FusedKernel)
+  struct ScvIpViews
+  {
+    SharedMemView<DoubleType*> densityNp1;
+    SharedMemView<DoubleType*> scvVolume;
+  };
+
+  ScvIpViews bind_scv_ip_views(ScratchViews<DoubleType>&) const;
+
+  /** Contribution of a single scv integration point; defined inline so that
+   *  a fused kernel stack can run it in a shared integration point loop
+   */
+  void scv_ip_execute(
+    const int ip,
+    const ScvIpViews&,
+    SharedMemView<DoubleType**>&,
+    SharedMemView<DoubleType*>&) const;
+
 private:
   MomentumBuoyancySrcElemKernel() = delete;
 
@@ -59,6 +77,33 @@ private:
   AlignedViewType<DoubleType[AlgTraits::numScvIp_][AlgTraits::nodesPerElement_]> v_shape_function_ { "v_shape_func" };
 };
 
+template<typename AlgTraits>
+inline void
+MomentumBuoyancySrcElemKernel<AlgTraits>::scv_ip_execute(
+  const int ip,
+  const ScvIpViews& v,
+  SharedMemView<DoubleType**>& /* lhs */,
+  SharedMemView<DoubleType*>& rhs) const
+{
+  const int nearestNode = ipNodeMap_[ip];
+  DoubleType rhoNp1 = 0.0;
+
+  for (int ic=0; ic < AlgTraits::nodesPerElement_; ++ic) {
+    const DoubleType r = v_shape_function_(ip, ic);
+    rhoNp1 += r * v.densityNp1(ic);
+  }
+
+  // Compute RHS
+  const DoubleType scV = v.scvVolume(ip);
+  const int nnNdim = nearestNode * AlgTraits::nDim_;
+  const DoubleType fac = (rhoNp1 - rhoRef_) * scV;
+  for (int j=0; j < AlgTraits::nDim_; j++) {
+    rhs(nnNdim + j) += fac * gravity_(j);
+  }
+
+  // No LHS contributions
+}
+
 }  // nalu
 }  // sierra
 
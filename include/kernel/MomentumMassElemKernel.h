@@ -50,6 +50,30 @@ public:
     SharedMemView<DoubleType*>&,
     ScratchViews<DoubleType>&);
 
+  /// Gathered views used at each scv integration point (see FusedKernel)
+  struct ScvIpViews
+  {
+    SharedMemView<DoubleType*> densityNm1;
+    SharedMemView<DoubleType*> densityN;
+    SharedMemView<DoubleType*> densityNp1;
+    SharedMemView<DoubleType**> velocityNm1;
+    SharedMemView<DoubleType**> velocityN;
+    SharedMemView<DoubleType**> velocityNp1;
+    SharedMemView<DoubleType**> Gjp;
+    SharedMemView<DoubleType*> scvVolume;
+  };
+
+  ScvIpViews bind_scv_ip_views(ScratchViews<DoubleType>&) const;
+
+  /** Contribution of a single scv integration point; defined inline so that
+   *  a fused kernel stack can run it in a shared integration point loop
+   */
+  void scv_ip_execute(
+    const int ip,
+    const ScvIpViews&,
+    SharedMemView<DoubleType**>&,
+    SharedMemView<DoubleType*>&) const;
+
 private:
   MomentumMassElemKernel() = delete;
 
@@ -77,6 +101,70 @@ private:
   AlignedViewType<DoubleType[AlgTraits::numScvIp_][AlgTraits::nodesPerElement_]> v_shape_function_ {"view_shape_func"};
 };
 
+template<typename AlgTraits>
+inline void
+MomentumMassElemKernel<AlgTraits>::scv_ip_execute(
+  const int ip,
+  const ScvIpViews& v,
+  SharedMemView<DoubleType**>& lhs,
+  SharedMemView<DoubleType*>& rhs) const
+{
+  NALU_ALIGNED DoubleType w_uNm1 [AlgTraits::nDim_];
+  NALU_ALIGNED DoubleType w_uN   [AlgTraits::nDim_];
+  NALU_ALIGNED DoubleType w_uNp1 [AlgTraits::nDim_];
+  NALU_ALIGNED DoubleType w_Gjp  [AlgTraits::nDim_];
+
+  const int nearestNode = ipNodeMap_[ip];
+
+  DoubleType rhoNm1 = 0.0;
+  DoubleType rhoN   = 0.0;
+  DoubleType rhoNp1 = 0.0;
+  for (int j=0; j < AlgTraits::nDim_; j++) {
+    w_uNm1[j] = 0.0;
+    w_uN[j] = 0.0;
+    w_uNp1[j] = 0.0;
+    w_Gjp[j] = 0.0;
+  }
+
+  for (int ic=0; ic < AlgTraits::nodesPerElement_; ++ic) {
+    const DoubleType r = v_shape_function_(ip, ic);
+
+    rhoNm1 += r * v.densityNm1(ic);
+    rhoN   += r * v.densityN(ic);
+    rhoNp1 += r * v.densityNp1(ic);
+    for (int j=0; j < AlgTraits::nDim_; j++) {
+      w_uNm1[j] += r * v.velocityNm1(ic, j);
+      w_uN[j]   += r * v.velocityN(ic, j);
+      w_uNp1[j] += r * v.velocityNp1(ic, j);
+      w_Gjp[j]  += r * v.Gjp(ic, j);
+    }
+  }
+
+  const DoubleType scV = v.scvVolume(ip);
+  const int nnNdim = nearestNode * AlgTraits::nDim_;
+  // Compute RHS; with possible density scaling
+  const DoubleType densFac = rhoNp1*densFac_ + om_densFac_;
+  for (int j=0; j < AlgTraits::nDim_; ++j) {
+    rhs(nnNdim + j) +=
+      - ( gamma1_ * rhoNp1 * w_uNp1[j] +
+          gamma2_ * rhoN   * w_uN[j] +
+          gamma3_ * rhoNm1 * w_uNm1[j]) * scV / dt_
+      - w_Gjp[j] * scV * densFac;
+  }
+
+  // Compute LHS
+  for (int ic=0; ic < AlgTraits::nodesPerElement_; ++ic) {
+    const int icNdim = ic * AlgTraits::nDim_;
+    const DoubleType r = v_shape_function_(ip, ic);
+    const DoubleType lhsfac = r * gamma1_ * rhoNp1 * scV / dt_;
+
+    for (int j=0; j<AlgTraits::nDim_; ++j) {
+      const int indexNN = nnNdim + j;
+      lhs(indexNN,icNdim+j) += lhsfac;
+    }
+  }
+}
+
 }  // nalu
 }  // sierra
 
@@ -261,7 +261,7 @@ namespace nalu {
   }
 
   template <typename CoordViewType>
-  void subdivide_hex_8(CoordViewType coords, typename CoordViewType::value_type coordv[27][3])
+  void subdivide_hex_8(CoordViewType coords, typename CoordViewType::non_const_value_type coordv[27][3])
   {
     /**
      * Subdivide the coordinates of a hex8 element into 8 hexs along edge, face, and volume midpoints
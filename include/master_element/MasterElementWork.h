@@ -0,0 +1,526 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+#ifndef MasterElementWork_h
+#define MasterElementWork_h
+
+#include <AlgTraits.h>
+#include <KokkosInterface.h>
+#include <SimdInterface.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <type_traits>
+
+namespace sierra {
+namespace nalu {
+
+  /**
+   * C++ counterparts of the element workset routines of MasterElementWork.F
+   * (*_gradient_operator, *_gij and the face *_scs_det routines). They are
+   * templated on the element traits and the view type so that the same
+   * code serves the SIMD (DoubleType) views and the double workset API.
+   *
+   * The double API keeps the Fortran workset layout, element index
+   * innermost after the per-element block:
+   *   cordel(dim,npe,nelem), gradop(dim,npe,nelem,nint),
+   *   det_j(nelem,nint), area_vec(dim,nelem,nint)
+   * The workset view helpers return unmanaged views of one element ke of
+   * such a workset in the (ip,node,dim) ordering of the SIMD views, and the
+   * workset_gradient_operator/workset_gij drivers loop over the elements.
+   */
+
+  template <typename T>
+  using WorksetView = Kokkos::View<T, Kokkos::LayoutStride, HostSpace, Kokkos::MemoryUnmanaged>;
+
+  // smallest Jacobian determinant accepted by the gradient operators
+  constexpr double workset_det_j_clip = 1.0e6*2.2250738585072014e-308;
+
+  // deriv(dim,npe,nint) -> (ip,node,dim)
+  inline WorksetView<const double***> workset_deriv(
+    const double *deriv, const int nint, const int npe, const int dim)
+  {
+    return WorksetView<const double***>(deriv,
+      Kokkos::LayoutStride(nint, npe*dim, npe, dim, dim, 1));
+  }
+
+  // cordel(dim,npe,nelem) -> (node,dim) of element ke
+  inline WorksetView<const double**> workset_coords(
+    const double *cordel, const int ke, const int npe, const int dim)
+  {
+    return WorksetView<const double**>(cordel + ke*npe*dim,
+      Kokkos::LayoutStride(npe, dim, dim, 1));
+  }
+
+  // gradop(dim,npe,nelem,nint) -> (ip,node,dim) of element ke
+  inline WorksetView<double***> workset_gradop(
+    double *gradop, const int ke, const int nelem, const int nint, const int npe, const int dim)
+  {
+    return WorksetView<double***>(gradop + ke*npe*dim,
+      Kokkos::LayoutStride(nint, nelem*npe*dim, npe, dim, dim, 1));
+  }
+
+  // det_j(nelem,nint), vol(nelem,nint) -> (ip) of element ke
+  inline WorksetView<double*> workset_scalar(
+    double *values, const int ke, const int nelem, const int nint)
+  {
+    return WorksetView<double*>(values + ke, Kokkos::LayoutStride(nint, nelem));
+  }
+
+  // area_vec(dim,nelem,nint) -> (ip,dim) of element ke
+  inline WorksetView<double**> workset_vector(
+    double *values, const int ke, const int nelem, const int nint, const int dim)
+  {
+    return WorksetView<double**>(values + ke*dim,
+      Kokkos::LayoutStride(nint, nelem*dim, dim, 1));
+  }
+
+  // gupperij(dim,dim,nint) -> (ip,dim,dim); symmetric
+  inline WorksetView<double***> workset_tensor(
+    double *values, const int nint, const int dim)
+  {
+    return WorksetView<double***>(values,
+      Kokkos::LayoutStride(nint, dim*dim, dim, dim, dim, 1));
+  }
+
+  //-------- element_gradient_operator ---------------------------------------
+  template <typename AlgTraits, typename DerivViewType, typename CoordViewType,
+            typename GradViewType, typename DetjViewType>
+  typename CoordViewType::non_const_value_type
+  element_gradient_operator(
+    std::integral_constant<int, 3>,
+    const DerivViewType& deriv,
+    const CoordViewType& coords,
+    const GradViewType& gradop,
+    const DetjViewType& det_j)
+  {
+    using ftype = typename CoordViewType::non_const_value_type;
+    constexpr int npe = AlgTraits::nodesPerElement_;
+
+    ftype err = 0.0;
+    for (unsigned ip = 0; ip < deriv.extent(0); ++ip) {
+      ftype dx_ds1 = 0.0, dx_ds2 = 0.0, dx_ds3 = 0.0;
+      ftype dy_ds1 = 0.0, dy_ds2 = 0.0, dy_ds3 = 0.0;
+      ftype dz_ds1 = 0.0, dz_ds2 = 0.0, dz_ds3 = 0.0;
+
+      // calculate the jacobian at the integration station
+      for (int n = 0; n < npe; ++n) {
+        dx_ds1 += deriv(ip,n,0)*coords(n,0);
+        dx_ds2 += deriv(ip,n,1)*coords(n,0);
+        dx_ds3 += deriv(ip,n,2)*coords(n,0);
+
+        dy_ds1 += deriv(ip,n,0)*coords(n,1);
+        dy_ds2 += deriv(ip,n,1)*coords(n,1);
+        dy_ds3 += deriv(ip,n,2)*coords(n,1);
+
+        dz_ds1 += deriv(ip,n,0)*coords(n,2);
+        dz_ds2 += deriv(ip,n,1)*coords(n,2);
+        dz_ds3 += deriv(ip,n,2)*coords(n,2);
+      }
+
+      const ftype det = dx_ds1*( dy_ds2*dz_ds3 - dz_ds2*dy_ds3 )
+                      + dy_ds1*( dz_ds2*dx_ds3 - dx_ds2*dz_ds3 )
+                      + dz_ds1*( dx_ds2*dy_ds3 - dy_ds2*dx_ds3 );
+      det_j(ip) = det;
+
+      // protect against a negative or small value for the determinant
+      const ftype test = stk::math::if_then_else(det <= workset_det_j_clip, ftype(1.0), det);
+      err = stk::math::if_then_else(det <= workset_det_j_clip, ftype(1.0), err);
+      const ftype denom = 1.0/test;
+
+      const ftype ds1_dx = denom*(dy_ds2*dz_ds3 - dz_ds2*dy_ds3);
+      const ftype ds2_dx = denom*(dz_ds1*dy_ds3 - dy_ds1*dz_ds3);
+      const ftype ds3_dx = denom*(dy_ds1*dz_ds2 - dz_ds1*dy_ds2);
+
+      const ftype ds1_dy = denom*(dz_ds2*dx_ds3 - dx_ds2*dz_ds3);
+      const ftype ds2_dy = denom*(dx_ds1*dz_ds3 - dz_ds1*dx_ds3);
+      const ftype ds3_dy = denom*(dz_ds1*dx_ds2 - dx_ds1*dz_ds2);
+
+      const ftype ds1_dz = denom*(dx_ds2*dy_ds3 - dy_ds2*dx_ds3);
+      const ftype ds2_dz = denom*(dy_ds1*dx_ds3 - dx_ds1*dy_ds3);
+      const ftype ds3_dz = denom*(dx_ds1*dy_ds2 - dy_ds1*dx_ds2);
+
+      for (int n = 0; n < npe; ++n) {
+        gradop(ip,n,0) = deriv(ip,n,0)*ds1_dx + deriv(ip,n,1)*ds2_dx + deriv(ip,n,2)*ds3_dx;
+        gradop(ip,n,1) = deriv(ip,n,0)*ds1_dy + deriv(ip,n,1)*ds2_dy + deriv(ip,n,2)*ds3_dy;
+        gradop(ip,n,2) = deriv(ip,n,0)*ds1_dz + deriv(ip,n,1)*ds2_dz + deriv(ip,n,2)*ds3_dz;
+      }
+    }
+    return err;
+  }
+
+  template <typename AlgTraits, typename DerivViewType, typename CoordViewType,
+            typename GradViewType, typename DetjViewType>
+  typename CoordViewType::non_const_value_type
+  element_gradient_operator(
+    std::integral_constant<int, 2>,
+    const DerivViewType& deriv,
+    const CoordViewType& coords,
+    const GradViewType& gradop,
+    const DetjViewType& det_j)
+  {
+    using ftype = typename CoordViewType::non_const_value_type;
+    constexpr int npe = AlgTraits::nodesPerElement_;
+
+    ftype err = 0.0;
+    for (unsigned ip = 0; ip < deriv.extent(0); ++ip) {
+      ftype dx_ds1 = 0.0, dx_ds2 = 0.0;
+      ftype dy_ds1 = 0.0, dy_ds2 = 0.0;
+
+      // calculate the jacobian at the integration station
+      for (int n = 0; n < npe; ++n) {
+        dx_ds1 += deriv(ip,n,0)*coords(n,0);
+        dx_ds2 += deriv(ip,n,1)*coords(n,0);
+
+        dy_ds1 += deriv(ip,n,0)*coords(n,1);
+        dy_ds2 += deriv(ip,n,1)*coords(n,1);
+      }
+
+      const ftype det = dx_ds1*dy_ds2 - dy_ds1*dx_ds2;
+      det_j(ip) = det;
+
+      // protect against a negative or small value for the determinant
+      const ftype test = stk::math::if_then_else(det <= workset_det_j_clip, ftype(1.0), det);
+      err = stk::math::if_then_else(det <= workset_det_j_clip, ftype(1.0), err);
+      const ftype denom = 1.0/test;
+
+      const ftype ds1_dx =  denom*dy_ds2;
+      const ftype ds2_dx = -denom*dy_ds1;
+
+      const ftype ds1_dy = -denom*dx_ds2;
+      const ftype ds2_dy =  denom*dx_ds1;
+
+      for (int n = 0; n < npe; ++n) {
+        gradop(ip,n,0) = deriv(ip,n,0)*ds1_dx + deriv(ip,n,1)*ds2_dx;
+        gradop(ip,n,1) = deriv(ip,n,0)*ds1_dy + deriv(ip,n,1)*ds2_dy;
+      }
+    }
+    return err;
+  }
+
+  /**
+   * Gradient operator and Jacobian determinant at each integration station;
+   * returns the positive volume check (0 = no error, 1 = error), which is
+   * per lane for DoubleType
+   */
+  template <typename AlgTraits, typename DerivViewType, typename CoordViewType,
+            typename GradViewType, typename DetjViewType>
+  typename CoordViewType::non_const_value_type
+  element_gradient_operator(
+    const DerivViewType& deriv,
+    const CoordViewType& coords,
+    const GradViewType& gradop,
+    const DetjViewType& det_j)
+  {
+    return element_gradient_operator<AlgTraits>(
+      std::integral_constant<int, AlgTraits::nDim_>(), deriv, coords, gradop, det_j);
+  }
+
+  //-------- element_gij -----------------------------------------------------
+  template <typename AlgTraits, typename DerivViewType, typename CoordViewType, typename GijViewType>
+  void element_gij(
+    std::integral_constant<int, 3>,
+    const DerivViewType& deriv,
+    const CoordViewType& coords,
+    const GijViewType& gupper,
+    const GijViewType& glower)
+  {
+    using ftype = typename CoordViewType::non_const_value_type;
+    constexpr int npe = AlgTraits::nodesPerElement_;
+
+    for (unsigned ip = 0; ip < deriv.extent(0); ++ip) {
+      ftype dx_ds[3][3] = { {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0} };
+      for (int n = 0; n < npe; ++n) {
+        for (int i = 0; i < 3; ++i) {
+          for (int j = 0; j < 3; ++j) {
+            dx_ds[i][j] += deriv(ip,n,j)*coords(n,i);
+          }
+        }
+      }
+
+      const ftype det_j = dx_ds[0][0]*(dx_ds[1][1]*dx_ds[2][2] - dx_ds[2][1]*dx_ds[1][2])
+                        + dx_ds[1][0]*(dx_ds[2][1]*dx_ds[0][2] - dx_ds[0][1]*dx_ds[2][2])
+                        + dx_ds[2][0]*(dx_ds[0][1]*dx_ds[1][2] - dx_ds[1][1]*dx_ds[0][2]);
+
+      // clip
+      const ftype denom = stk::math::if_then_else(det_j <= workset_det_j_clip, ftype(1.0), 1.0/det_j);
+
+      ftype ds_dx[3][3];
+      ds_dx[0][0] = denom*(dx_ds[1][1]*dx_ds[2][2] - dx_ds[2][1]*dx_ds[1][2]);
+      ds_dx[0][1] = denom*(dx_ds[2][1]*dx_ds[0][2] - dx_ds[0][1]*dx_ds[2][2]);
+      ds_dx[0][2] = denom*(dx_ds[0][1]*dx_ds[1][2] - dx_ds[1][1]*dx_ds[0][2]);
+
+      ds_dx[1][0] = denom*(dx_ds[2][0]*dx_ds[1][2] - dx_ds[1][0]*dx_ds[2][2]);
+      ds_dx[1][1] = denom*(dx_ds[0][0]*dx_ds[2][2] - dx_ds[2][0]*dx_ds[0][2]);
+      ds_dx[1][2] = denom*(dx_ds[1][0]*dx_ds[0][2] - dx_ds[0][0]*dx_ds[1][2]);
+
+      ds_dx[2][0] = denom*(dx_ds[1][0]*dx_ds[2][1] - dx_ds[2][0]*dx_ds[1][1]);
+      ds_dx[2][1] = denom*(dx_ds[2][0]*dx_ds[0][1] - dx_ds[0][0]*dx_ds[2][1]);
+      ds_dx[2][2] = denom*(dx_ds[0][0]*dx_ds[1][1] - dx_ds[1][0]*dx_ds[0][1]);
+
+      for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+          gupper(ip,i,j) = dx_ds[i][0]*dx_ds[j][0] + dx_ds[i][1]*dx_ds[j][1] + dx_ds[i][2]*dx_ds[j][2];
+          glower(ip,i,j) = ds_dx[0][i]*ds_dx[0][j] + ds_dx[1][i]*ds_dx[1][j] + ds_dx[2][i]*ds_dx[2][j];
+        }
+      }
+    }
+  }
+
+  template <typename AlgTraits, typename DerivViewType, typename CoordViewType, typename GijViewType>
+  void element_gij(
+    std::integral_constant<int, 2>,
+    const DerivViewType& deriv,
+    const CoordViewType& coords,
+    const GijViewType& gupper,
+    const GijViewType& glower)
+  {
+    using ftype = typename CoordViewType::non_const_value_type;
+    constexpr int npe = AlgTraits::nodesPerElement_;
+
+    for (unsigned ip = 0; ip < deriv.extent(0); ++ip) {
+      ftype dx_ds[2][2] = { {0.0, 0.0}, {0.0, 0.0} };
+      for (int n = 0; n < npe; ++n) {
+        for (int i = 0; i < 2; ++i) {
+          for (int j = 0; j < 2; ++j) {
+            dx_ds[i][j] += deriv(ip,n,j)*coords(n,i);
+          }
+        }
+      }
+
+      const ftype det_j = dx_ds[0][0]*dx_ds[1][1] - dx_ds[1][0]*dx_ds[0][1];
+
+      // clip
+      const ftype denom = stk::math::if_then_else(det_j <= workset_det_j_clip, ftype(1.0), 1.0/det_j);
+
+      ftype ds_dx[2][2];
+      ds_dx[0][0] =  dx_ds[1][1]*denom;
+      ds_dx[0][1] = -dx_ds[0][1]*denom;
+      ds_dx[1][0] = -dx_ds[1][0]*denom;
+      ds_dx[1][1] =  dx_ds[0][0]*denom;
+
+      for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < 2; ++j) {
+          gupper(ip,i,j) = dx_ds[i][0]*dx_ds[j][0] + dx_ds[i][1]*dx_ds[j][1];
+          glower(ip,i,j) = ds_dx[0][i]*ds_dx[0][j] + ds_dx[1][i]*ds_dx[1][j];
+        }
+      }
+    }
+  }
+
+  /**
+   * Contravariant (gupper) and covariant (glower) metric tensors at each
+   * integration station, glower formed from the clipped inverse Jacobian
+   */
+  template <typename AlgTraits, typename DerivViewType, typename CoordViewType, typename GijViewType>
+  void element_gij(
+    const DerivViewType& deriv,
+    const CoordViewType& coords,
+    const GijViewType& gupper,
+    const GijViewType& glower)
+  {
+    element_gij<AlgTraits>(
+      std::integral_constant<int, AlgTraits::nDim_>(), deriv, coords, gupper, glower);
+  }
+
+  // no-op Jacobian check for tri2d_scv_volumes
+  struct IgnoreDetJ {
+    template <typename T> void operator()(int /* ki */, const T& /* detj */) const {}
+  };
+
+  //-------- tri2d_scv_volumes -----------------------------------------------
+  // checkDetJ(ki, det_j) sees every quadrature point Jacobian, as the
+  // det_j <= 0 test of tri_scv_det
+  template <typename CoordViewType, typename VolumeViewType, typename DetJCheck = IgnoreDetJ>
+  void tri2d_scv_volumes(
+    const CoordViewType& coords,
+    const VolumeViewType& vol,
+    const DetJCheck& checkDetJ = DetJCheck())
+  {
+    using ftype = typename CoordViewType::non_const_value_type;
+
+    // Gaussian quadrature points within an interval [-.5,+.5]
+    const double gpp =  0.288675134;
+    const double gpm = -0.288675134;
+    const double xigp[2][4] = {{gpm, gpp, gpp, gpm},
+                               {gpm, gpm, gpp, gpp}};
+
+    const double half = 0.5;
+    const double one4th = 0.25;
+    const double one3rd = 1.0/3.0;
+
+    // 2d cartesian, no cross-section area
+    const ftype xc = one3rd*(coords(0,0)+coords(1,0)+coords(2,0));
+    const ftype yc = one3rd*(coords(0,1)+coords(1,1)+coords(2,1));
+
+    // each sub-volume is the quad node, mid-edge, centroid, mid-edge
+    ftype xyval[2][4][3];
+    for ( int k = 0; k < 2; ++k ) {
+      const ftype c = (k == 0) ? xc : yc;
+      for ( int ki = 0; ki < 3; ++ki ) {
+        const int kn = (ki+1)%3;
+        const int kp = (ki+2)%3;
+        xyval[k][0][ki] = coords(ki,k);
+        xyval[k][1][ki] = half*(coords(ki,k)+coords(kn,k));
+        xyval[k][2][ki] = c;
+        xyval[k][3][ki] = half*(coords(kp,k)+coords(ki,k));
+      }
+    }
+
+    for ( int ki = 0; ki < 3; ++ki ) {
+      vol(ki) = 0.0;
+      for ( int kq = 0; kq < 4; ++kq ) {
+        const double ximod  = xigp[0][kq];
+        const double etamod = xigp[1][kq];
+        const double deriv[2][4] = {
+          {-(half - etamod),  (half - etamod), (half + etamod), -(half + etamod)},
+          {-(half - ximod),  -(half + ximod),  (half + ximod),   (half - ximod)}};
+
+        // calculate the jacobian at the integration station
+        ftype dx_ds1 = 0.0, dx_ds2 = 0.0, dy_ds1 = 0.0, dy_ds2 = 0.0;
+        for ( int kn = 0; kn < 4; ++kn ) {
+          dx_ds1 += deriv[0][kn]*xyval[0][kn][ki];
+          dx_ds2 += deriv[1][kn]*xyval[0][kn][ki];
+          dy_ds1 += deriv[0][kn]*xyval[1][kn][ki];
+          dy_ds2 += deriv[1][kn]*xyval[1][kn][ki];
+        }
+        const ftype detj = dx_ds1*dy_ds2 - dy_ds1*dx_ds2;
+        checkDetJ(ki, detj);
+        vol(ki) += detj*one4th;
+      }
+    }
+  }
+
+  //-------- quad3d_scs_area_vector ------------------------------------------
+  template <typename CoordViewType, typename AreaViewType>
+  void quad3d_scs_area_vector(
+    const CoordViewType& coords,
+    const AreaViewType& areav)
+  {
+    using ftype = typename CoordViewType::non_const_value_type;
+
+    // each subcontrol face joins two edge midpoints to the face centroid
+    constexpr int nodesPerFace = 4;
+    for (int ip = 0; ip < nodesPerFace; ++ip) {
+      const int prev = (ip + nodesPerFace - 1) % nodesPerFace;
+      const int next = (ip + 1) % nodesPerFace;
+      ftype dx13[3];
+      ftype dx24[3];
+      for (int d = 0; d < 3; ++d) {
+        const ftype centroid = 0.25*(coords(0,d) + coords(1,d) + coords(2,d) + coords(3,d));
+        const ftype ePrev = 0.5*(coords(prev,d) + coords(ip,d));
+        const ftype eNext = 0.5*(coords(ip,d) + coords(next,d));
+        dx13[d] = centroid - coords(ip,d);
+        dx24[d] = ePrev - eNext;
+      }
+      areav(ip,0) = 0.5*(dx24[2]*dx13[1] - dx13[2]*dx24[1]);
+      areav(ip,1) = 0.5*(dx24[0]*dx13[2] - dx13[0]*dx24[2]);
+      areav(ip,2) = 0.5*(dx24[1]*dx13[0] - dx13[1]*dx24[0]);
+    }
+  }
+
+  //-------- tri3d_scs_area_vector -------------------------------------------
+  template <typename CoordViewType, typename AreaViewType>
+  void tri3d_scs_area_vector(
+    const CoordViewType& coords,
+    const AreaViewType& areav)
+  {
+    using ftype = typename CoordViewType::non_const_value_type;
+
+    constexpr int nodesPerFace = 3;
+    constexpr double one3rd = 1.0/3.0;
+    for (int ip = 0; ip < nodesPerFace; ++ip) {
+      const int prev = (ip + nodesPerFace - 1) % nodesPerFace;
+      const int next = (ip + 1) % nodesPerFace;
+      ftype dx13[3];
+      ftype dx24[3];
+      for (int d = 0; d < 3; ++d) {
+        const ftype centroid = one3rd*(coords(0,d) + coords(1,d) + coords(2,d));
+        const ftype ePrev = 0.5*(coords(prev,d) + coords(ip,d));
+        const ftype eNext = 0.5*(coords(ip,d) + coords(next,d));
+        dx13[d] = centroid - coords(ip,d);
+        dx24[d] = ePrev - eNext;
+      }
+      areav(ip,0) = 0.5*(dx24[2]*dx13[1] - dx13[2]*dx24[1]);
+      areav(ip,1) = 0.5*(dx24[0]*dx13[2] - dx13[0]*dx24[2]);
+      areav(ip,2) = 0.5*(dx24[1]*dx13[0] - dx13[1]*dx24[0]);
+    }
+  }
+
+  //-------- edge2d_scs_area_vector ------------------------------------------
+  template <typename CoordViewType, typename AreaViewType>
+  void edge2d_scs_area_vector(
+    const CoordViewType& coords,
+    const AreaViewType& areav)
+  {
+    using ftype = typename CoordViewType::non_const_value_type;
+
+    const ftype xc = 0.5*(coords(0,0) + coords(1,0));
+    const ftype yc = 0.5*(coords(0,1) + coords(1,1));
+
+    areav(0,0) = -(coords(0,1) - yc);
+    areav(0,1) =   coords(0,0) - xc;
+
+    areav(1,0) =   coords(1,1) - yc;
+    areav(1,1) = -(coords(1,0) - xc);
+  }
+
+  //-------- workset_gradient_operator ---------------------------------------
+  /**
+   * Double workset driver of element_gradient_operator replacing the
+   * Fortran *_gradient_operator calls; err(nelem) is set as in the Fortran
+   * and true is returned if any element fails the positive volume check
+   */
+  template <typename AlgTraits>
+  bool workset_gradient_operator(
+    const int nelem,
+    const int nint,
+    const double *deriv,
+    const double *coords,
+    double *gradop,
+    double *det_j,
+    double *err)
+  {
+    constexpr int npe = AlgTraits::nodesPerElement_;
+    constexpr int dim = AlgTraits::nDim_;
+
+    const WorksetView<const double***> derivView = workset_deriv(deriv, nint, npe, dim);
+    bool lerr = false;
+    for (int ke = 0; ke < nelem; ++ke) {
+      err[ke] = element_gradient_operator<AlgTraits>(
+        derivView,
+        workset_coords(coords, ke, npe, dim),
+        workset_gradop(gradop, ke, nelem, nint, npe, dim),
+        workset_scalar(det_j, ke, nelem, nint));
+      lerr = lerr || (err[ke] != 0.0);
+    }
+    return lerr;
+  }
+
+  //-------- workset_gij -----------------------------------------------------
+  template <typename AlgTraits>
+  void workset_gij(
+    const int nint,
+    const double *deriv,
+    const double *coords,
+    double *gupperij,
+    double *glowerij)
+  {
+    constexpr int npe = AlgTraits::nodesPerElement_;
+    constexpr int dim = AlgTraits::nDim_;
+
+    element_gij<AlgTraits>(
+      workset_deriv(deriv, nint, npe, dim),
+      workset_coords(coords, 0, npe, dim),
+      workset_tensor(gupperij, nint, dim),
+      workset_tensor(glowerij, nint, dim));
+  }
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
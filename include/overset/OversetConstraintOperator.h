@@ -0,0 +1,81 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef OversetConstraintOperator_h
+#define OversetConstraintOperator_h
+
+//==============================================================================
+// Includes and forwards
+//==============================================================================
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+}
+}
+
+namespace sierra {
+namespace nalu {
+
+class OversetInfo;
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// OversetConstraintOperator
+//=============================================================================
+class OversetConstraintOperator {
+
+ public:
+
+  // constructor and destructor
+  OversetConstraintOperator();
+
+  ~OversetConstraintOperator();
+
+  // rows from the search product; unchanged donors keep their weights
+  void build(
+    const stk::mesh::BulkData &bulkData,
+    const std::vector<OversetInfo *> &infoVec,
+    const int nDim);
+
+  // interpolate donor values to the constraint nodes
+  void apply(
+    stk::mesh::FieldBase &theField,
+    const int sizeOfField) const;
+
+  size_t num_rows() const { return rowNodes_.size(); }
+
+  // rows whose weights were evaluated by the last build
+  size_t num_recomputed() const { return numRecomputed_; }
+
+  // CSR storage; one row per constraint node, columns are the donor element nodes
+  std::vector<stk::mesh::Entity> rowNodes_;
+  std::vector<size_t> rowPtr_;
+  std::vector<stk::mesh::Entity> colNodes_;
+  std::vector<double> weights_;
+
+  // donor of each row; decides reuse in the next build
+  std::vector<stk::mesh::EntityId> rowIds_;
+  std::vector<stk::mesh::EntityId> donorIds_;
+  std::vector<double> isoParCoords_;
+
+  size_t numRecomputed_;
+
+};
+
+} // end sierra namespace
+} // end nalu namespace
+
+#endif
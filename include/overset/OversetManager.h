@@ -8,6 +8,8 @@
 #ifndef OVERSETMANAGER_H
 #define OVERSETMANAGER_H
 
+#include "overset/OversetConstraintOperator.h"
+
 #include <stk_mesh/base/Selector.hpp>
 
 #include <vector>
@@ -71,12 +73,19 @@ public:
     const int,
     const int);
 
-  // general update that expects provided vector
+  // general update that applies the provided operator
   virtual void overset_constraint_node_field_update_gen(
     stk::mesh::FieldBase*,
     const int,
     const int,
-    std::vector<OversetInfo *> &);
+    const OversetConstraintOperator &);
+
+  /** Compile the info vecs into constraint operators after each search
+   *
+   *  Rows whose donor element and isoparametric coordinates did not change
+   *  since the previous search keep their weights.
+   */
+  void build_constraint_operators();
 
   /** Return an inactive selector that contains the hole elements
    */
@@ -100,6 +109,10 @@ public:
   std::vector<OversetInfo*> oversetInfoVec_;
   std::vector<OversetInfo*> fringeInfoVec_;
 
+  // interpolation operators compiled from the two info vecs
+  OversetConstraintOperator oversetOperator_;
+  OversetConstraintOperator fringeOperator_;
+
   std::vector<int> ghostCommProcs_;
 
 private:
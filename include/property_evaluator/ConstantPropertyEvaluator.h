@@ -30,6 +30,15 @@ class ConstantPropertyEvaluator : public PropertyEvaluator
   double execute(double *indVarList,
                  stk::mesh::Entity node);
 
+  void execute_bucket(const stk::mesh::Bucket &bucket,
+                      const double *indVar,
+                      double *prop);
+
+  bool provide_input_fields(
+    std::vector<const stk::mesh::FieldBase *> &/*inputFields*/) const {
+    return true;
+  }
+
   double value_;
 
 };
@@ -38,6 +38,16 @@ public:
   double execute(
     double *indVarList,
     stk::mesh::Entity node);
+
+  void execute_bucket(
+    const stk::mesh::Bucket &bucket,
+    const double *indVar,
+    double *prop);
+
+  bool provide_input_fields(
+    std::vector<const stk::mesh::FieldBase *> &/*inputFields*/) const {
+    return true;
+  }
   
   const double pRef_;
   const double R_;
@@ -58,9 +68,25 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void execute_bucket(
+      const stk::mesh::Bucket &bucket,
+      const double *indVar,
+      double *prop);
+
+  bool provide_input_fields(
+    std::vector<const stk::mesh::FieldBase *> &inputFields) const {
+    inputFields.push_back(massFraction_);
+    return true;
+  }
   
   double compute_mw(
       const double *yk);
+
+  // mixture mw of a SIMD group of numLanes nodes starting at yk
+  DoubleType compute_mw(
+      const double *yk,
+      const int numLanes);
   
   // reference quantities
   const double pRef_;
@@ -89,6 +115,17 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void execute_bucket(
+      const stk::mesh::Bucket &bucket,
+      const double *indVar,
+      double *prop);
+
+  bool provide_input_fields(
+    std::vector<const stk::mesh::FieldBase *> &inputFields) const {
+    inputFields.push_back(pressure_);
+    return true;
+  }
+
   // reference quantities
   const double R_;
 
@@ -114,9 +151,25 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void execute_bucket(
+      const stk::mesh::Bucket &bucket,
+      const double *indVar,
+      double *prop);
+
+  bool provide_input_fields(
+    std::vector<const stk::mesh::FieldBase *> &inputFields) const {
+    inputFields.push_back(massFraction_);
+    return true;
+  }
   
   double compute_mw(
       const double *yk);
+
+  // mixture mw of a SIMD group of numLanes nodes starting at yk
+  DoubleType compute_mw(
+      const double *yk,
+      const int numLanes);
   
   // reference quantities
   const double pRef_;
@@ -146,6 +199,16 @@ public:
   double execute(
     double *indVarList,
     stk::mesh::Entity node);
+
+  void execute_bucket(
+    const stk::mesh::Bucket &bucket,
+    const double *indVar,
+    double *prop);
+
+  bool provide_input_fields(
+    std::vector<const stk::mesh::FieldBase *> &/*inputFields*/) const {
+    return true;
+  }
   
   double compute_mw(
     const double *yk);
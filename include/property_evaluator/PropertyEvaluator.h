@@ -9,10 +9,19 @@
 #ifndef PropertyEvaluator_h
 #define PropertyEvaluator_h
 
+#include <SimdInterface.h>
+
 #include <stk_mesh/base/Entity.hpp>
 
 #include <vector>
 
+namespace stk {
+namespace mesh {
+class Bucket;
+class FieldBase;
+}
+}
+
 namespace sierra{
 namespace nalu{
 
@@ -26,9 +35,46 @@ public:
   virtual double execute(
     double *indVarList,
     stk::mesh::Entity node = stk::mesh::Entity()) = 0;
+
+  // evaluate the property for every node of a bucket in one call; indVar is
+  // the bucket array of the independent variable (NULL when there is none)
+  // and prop the bucket array of the property. The default adapts the nodal
+  // execute() so that evaluators without a batched form keep working
+  virtual void execute_bucket(
+    const stk::mesh::Bucket &bucket,
+    const double *indVar,
+    double *prop);
+
+  // fields read by the evaluator beyond the independent variable; false when
+  // unreported, in which case the owning algorithm is never skipped
+  virtual bool provide_input_fields(
+    std::vector<const stk::mesh::FieldBase *> &/*inputFields*/) const {
+    return false;
+  }
   
 };
 
+// gather numLanes (<= simdLen) strided bucket values into a SIMD group;
+// trailing lanes repeat the last value so that they stay well defined
+inline DoubleType
+load_simd_group(const double *src, const int numLanes, const int stride = 1)
+{
+  DoubleType value;
+  for ( int simdIndex = 0; simdIndex < simdLen; ++simdIndex ) {
+    const int lane = simdIndex < numLanes ? simdIndex : numLanes - 1;
+    stk::simd::set_data(value, simdIndex, src[lane*stride]);
+  }
+  return value;
+}
+
+// scatter the first numLanes lanes of a SIMD group to a bucket array
+inline void
+store_simd_group(const DoubleType &value, double *dst, const int numLanes)
+{
+  for ( int simdIndex = 0; simdIndex < numLanes; ++simdIndex )
+    dst[simdIndex] = stk::simd::get_data(value, simdIndex);
+}
+
 } // namespace nalu
 } // namespace Sierra
 
@@ -53,11 +53,23 @@ public:
     const double &T,
     const double *pt_poly);
 
+  // SIMD group forms of the above
+  void mole_fraction_from_mass_fraction(
+    const double *mw, const DoubleType *massFraction, DoubleType *moleFraction);
+
+  DoubleType compute_viscosity(
+    const DoubleType &T,
+    const double *pt_poly);
+
   size_t ykVecSize_;  
   std::vector<double> refMassFraction_;
   std::vector<double> moleFraction_; // may be reference or work array
   std::vector<double> refMW_;
   std::vector<std::vector<double> > polynomialCoeffs_;
+
+  // SIMD group work arrays for the bucket evaluation
+  ScalarAlignedVector massFractionSimd_;
+  ScalarAlignedVector moleFractionSimd_;
 };
 
 class SutherlandsYkrefPropertyEvaluator : public SutherlandsPropertyEvaluator
@@ -71,7 +83,17 @@ public:
 
   virtual double execute(
     double *indVarList,
-    stk::mesh::Entity node);  
+    stk::mesh::Entity node);
+
+  void execute_bucket(
+    const stk::mesh::Bucket &bucket,
+    const double *indVar,
+    double *prop);
+
+  bool provide_input_fields(
+    std::vector<const stk::mesh::FieldBase *> &/*inputFields*/) const {
+    return true;
+  }
 };
 
 class SutherlandsYkPropertyEvaluator : public SutherlandsPropertyEvaluator
@@ -89,6 +111,17 @@ public:
     double *indVarList,
     stk::mesh::Entity node);
 
+  void execute_bucket(
+    const stk::mesh::Bucket &bucket,
+    const double *indVar,
+    double *prop);
+
+  bool provide_input_fields(
+    std::vector<const stk::mesh::FieldBase *> &inputFields) const {
+    inputFields.push_back(massFraction_);
+    return true;
+  }
+
   // field definition and extraction
   GenericFieldType *massFraction_;
 };
@@ -109,6 +142,17 @@ public:
     double *indVarList,
     stk::mesh::Entity node);
 
+  void execute_bucket(
+    const stk::mesh::Bucket &bucket,
+    const double *indVar,
+    double *prop);
+
+  bool provide_input_fields(
+    std::vector<const stk::mesh::FieldBase *> &inputFields) const {
+    inputFields.push_back(massFraction_);
+    return true;
+  }
+
   // field definition and extraction
   const double tRef_;
   GenericFieldType *massFraction_;
@@ -129,6 +173,16 @@ public:
     double *indVarList,
     stk::mesh::Entity node);
 
+  void execute_bucket(
+    const stk::mesh::Bucket &bucket,
+    const double *indVar,
+    double *prop);
+
+  bool provide_input_fields(
+    std::vector<const stk::mesh::FieldBase *> &/*inputFields*/) const {
+    return true;
+  }
+
   const double tRef_;
 };
 
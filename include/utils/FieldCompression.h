@@ -0,0 +1,388 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+#ifndef FIELDCOMPRESSION_H
+#define FIELDCOMPRESSION_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+namespace utils {
+
+/**
+ * Error-bounded lossy compression of field arrays
+ *
+ * Values are quantized onto a uniform grid whose spacing is twice the user
+ * error bound, so that every reconstructed value is within the bound. The
+ * integer grid indices are delta coded against the previous entry (entities
+ * are written in memory order, which is spatially coherent), zig-zag mapped
+ * and packed as variable length integers. Blocks that can not be quantized
+ * (non-finite values, zero error bound, overflow, or a reconstruction that
+ * round-off pushes past the bound) are stored raw.
+ */
+namespace compression {
+
+enum BlockEncoding : unsigned char {
+  RAW = 0,      //!< IEEE doubles
+  QUANTIZED = 1 //!< quantized, delta + varint coded
+};
+
+inline void
+put_varint(uint64_t value, std::vector<unsigned char>& out)
+{
+  while (value >= 0x80) {
+    out.push_back(static_cast<unsigned char>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<unsigned char>(value));
+}
+
+inline uint64_t
+get_varint(const unsigned char*& p, const unsigned char* end)
+{
+  uint64_t value = 0;
+  int shift = 0;
+  while (p < end) {
+    const unsigned char byte = *p++;
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if (!(byte & 0x80))
+      return value;
+    shift += 7;
+    if (shift > 63)
+      break;
+  }
+  throw std::runtime_error("FieldCompression: corrupt variable length integer");
+}
+
+inline uint64_t zigzag(int64_t v) { return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63); }
+inline int64_t unzigzag(uint64_t v) { return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1); }
+
+inline void
+put_double(double value, std::vector<unsigned char>& out)
+{
+  unsigned char bytes[sizeof(double)];
+  std::memcpy(bytes, &value, sizeof(double));
+  out.insert(out.end(), bytes, bytes + sizeof(double));
+}
+
+inline double
+get_double(const unsigned char*& p, const unsigned char* end)
+{
+  if (end - p < static_cast<std::ptrdiff_t>(sizeof(double)))
+    throw std::runtime_error("FieldCompression: truncated block");
+  double value;
+  std::memcpy(&value, p, sizeof(double));
+  p += sizeof(double);
+  return value;
+}
+
+/**
+ * Compress n values read with the given stride; every reconstructed value is
+ * within errorBound of the input
+ */
+inline void
+compress_block(
+  const double* values, size_t n, size_t stride, double errorBound,
+  std::vector<unsigned char>& out)
+{
+  // slightly finer than 2*errorBound so round-off in q*step stays in bounds
+  const double step = 2.0 * errorBound * (1.0 - 1.0e-10);
+  const double maxIndex = 9.0e15; // exact integers in a double
+
+  bool quantize = (errorBound > 0.0) && std::isfinite(step) && step > 0.0;
+  for (size_t k = 0; k < n && quantize; ++k) {
+    const double v = values[k * stride];
+    quantize = std::isfinite(v) && std::abs(v / step) < maxIndex;
+  }
+
+  // for large |v|/errorBound the round-off in q*step exceeds the margin in
+  // step; check every reconstruction and store the block raw if one misses
+  std::vector<int64_t> indices;
+  if (quantize) {
+    indices.resize(n);
+    for (size_t k = 0; k < n && quantize; ++k) {
+      const double v = values[k * stride];
+      indices[k] = std::llround(v / step);
+      quantize = std::abs(indices[k] * step - v) <= errorBound;
+    }
+  }
+
+  if (!quantize) {
+    out.push_back(RAW);
+    put_varint(n, out);
+    for (size_t k = 0; k < n; ++k)
+      put_double(values[k * stride], out);
+    return;
+  }
+
+  out.push_back(QUANTIZED);
+  put_varint(n, out);
+  put_double(step, out);
+  int64_t previous = 0;
+  for (size_t k = 0; k < n; ++k) {
+    put_varint(zigzag(indices[k] - previous), out);
+    previous = indices[k];
+  }
+}
+
+/**
+ * Decompress one block into values (written with the given stride); returns
+ * the number of values in the block
+ */
+inline size_t
+decompress_block(
+  const unsigned char*& p, const unsigned char* end,
+  double* values, size_t maxValues, size_t stride)
+{
+  if (p >= end)
+    throw std::runtime_error("FieldCompression: truncated block");
+  const unsigned char encoding = *p++;
+  const size_t n = get_varint(p, end);
+  if (n > maxValues)
+    throw std::runtime_error("FieldCompression: block larger than destination");
+
+  if (encoding == RAW) {
+    for (size_t k = 0; k < n; ++k)
+      values[k * stride] = get_double(p, end);
+  } else if (encoding == QUANTIZED) {
+    const double step = get_double(p, end);
+    int64_t q = 0;
+    for (size_t k = 0; k < n; ++k) {
+      q += unzigzag(get_varint(p, end));
+      values[k * stride] = q * step;
+    }
+  } else {
+    throw std::runtime_error("FieldCompression: unknown block encoding");
+  }
+  return n;
+}
+
+/**
+ * Lossless coding of entity ids (sorted or not) as zig-zag deltas
+ */
+inline void
+compress_ids(const std::vector<uint64_t>& ids, std::vector<unsigned char>& out)
+{
+  put_varint(ids.size(), out);
+  uint64_t previous = 0;
+  for (const uint64_t id : ids) {
+    put_varint(zigzag(static_cast<int64_t>(id - previous)), out);
+    previous = id;
+  }
+}
+
+inline void
+decompress_ids(const unsigned char*& p, const unsigned char* end, std::vector<uint64_t>& ids)
+{
+  ids.resize(get_varint(p, end));
+  uint64_t previous = 0;
+  for (uint64_t& id : ids) {
+    previous += static_cast<uint64_t>(unzigzag(get_varint(p, end)));
+    id = previous;
+  }
+}
+
+} // namespace compression
+
+/**
+ * Compressed field file layout (one file per rank)
+ *
+ *   magic "NALUCMP1"
+ *   records, each:  type byte | varint payload size | payload
+ *     'F' field definition: name, number of components, entity ids
+ *     'S' step: time, then per field and per component one compressed block
+ */
+class CompressedFieldFileWriter
+{
+public:
+  explicit CompressedFieldFileWriter(const std::string& fileName)
+    : file_(fileName.c_str(), std::ios::binary | std::ios::trunc),
+      bytesWritten_(0)
+  {
+    if (!file_)
+      throw std::runtime_error("CompressedFieldFileWriter: can not open " + fileName);
+    file_.write(magic(), 8);
+    bytesWritten_ += 8;
+  }
+
+  static const char* magic() { return "NALUCMP1"; }
+
+  //! Define a field; returns its index for write_step
+  size_t define_field(
+    const std::string& name, unsigned numComponents, const std::vector<uint64_t>& ids)
+  {
+    std::vector<unsigned char> payload;
+    compression::put_varint(name.size(), payload);
+    payload.insert(payload.end(), name.begin(), name.end());
+    compression::put_varint(numComponents, payload);
+    compression::compress_ids(ids, payload);
+    write_record('F', payload);
+    fieldSizes_.push_back(std::make_pair(ids.size(), numComponents));
+    return fieldSizes_.size() - 1;
+  }
+
+  //! Write one step; values[f] is entity-major, errorBounds[f] per field
+  void write_step(
+    double time,
+    const std::vector<const double*>& values,
+    const std::vector<double>& errorBounds)
+  {
+    if (values.size() != fieldSizes_.size() || errorBounds.size() != fieldSizes_.size())
+      throw std::runtime_error("CompressedFieldFileWriter: field count mismatch");
+
+    std::vector<unsigned char> payload;
+    compression::put_double(time, payload);
+    for (size_t f = 0; f < values.size(); ++f) {
+      const size_t numEntities = fieldSizes_[f].first;
+      const unsigned numComponents = fieldSizes_[f].second;
+      // component-major blocks compress better than interleaved data
+      for (unsigned c = 0; c < numComponents; ++c)
+        compression::compress_block(
+          values[f] + c, numEntities, numComponents, errorBounds[f], payload);
+    }
+    write_record('S', payload);
+    file_.flush();
+  }
+
+  size_t bytes_written() const { return bytesWritten_; }
+
+private:
+  void write_record(char type, const std::vector<unsigned char>& payload)
+  {
+    std::vector<unsigned char> header(1, static_cast<unsigned char>(type));
+    compression::put_varint(payload.size(), header);
+    file_.write(reinterpret_cast<const char*>(header.data()), header.size());
+    file_.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+    if (!file_)
+      throw std::runtime_error("CompressedFieldFileWriter: write failed");
+    bytesWritten_ += header.size() + payload.size();
+  }
+
+  std::ofstream file_;
+  size_t bytesWritten_;
+  std::vector<std::pair<size_t, unsigned>> fieldSizes_;
+};
+
+/**
+ * Reader for files produced by CompressedFieldFileWriter; reconstructs raw
+ * arrays (entity ids plus entity-major values) for any field and step
+ */
+class CompressedFieldFileReader
+{
+public:
+  explicit CompressedFieldFileReader(const std::string& fileName)
+  {
+    std::ifstream file(fileName.c_str(), std::ios::binary);
+    if (!file)
+      throw std::runtime_error("CompressedFieldFileReader: can not open " + fileName);
+    data_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    if (data_.size() < 8 || std::memcmp(data_.data(), CompressedFieldFileWriter::magic(), 8) != 0)
+      throw std::runtime_error("CompressedFieldFileReader: not a compressed field file: " + fileName);
+
+    const unsigned char* p = data_.data() + 8;
+    const unsigned char* end = data_.data() + data_.size();
+    while (p < end) {
+      const char type = static_cast<char>(*p++);
+      const size_t size = compression::get_varint(p, end);
+      if (static_cast<size_t>(end - p) < size)
+        throw std::runtime_error("CompressedFieldFileReader: truncated record");
+      const unsigned char* q = p;
+      if (type == 'F') {
+        FieldDef def;
+        const size_t nameLength = compression::get_varint(q, p + size);
+        def.name.assign(reinterpret_cast<const char*>(q), nameLength);
+        q += nameLength;
+        def.numComponents = compression::get_varint(q, p + size);
+        compression::decompress_ids(q, p + size, def.ids);
+        fieldIndex_[def.name] = fields_.size();
+        fields_.push_back(def);
+      } else if (type == 'S') {
+        steps_.push_back(std::make_pair(compression::get_double(q, p + size), p - data_.data()));
+        stepSizes_.push_back(size);
+      } else {
+        throw std::runtime_error("CompressedFieldFileReader: unknown record type");
+      }
+      p += size;
+    }
+  }
+
+  size_t num_steps() const { return steps_.size(); }
+  double time(size_t step) const { return steps_.at(step).first; }
+
+  std::vector<std::string> field_names() const
+  {
+    std::vector<std::string> names;
+    for (const FieldDef& def : fields_)
+      names.push_back(def.name);
+    return names;
+  }
+
+  unsigned num_components(const std::string& name) const { return field(name).numComponents; }
+  const std::vector<uint64_t>& ids(const std::string& name) const { return field(name).ids; }
+
+  //! Reconstruct the (entity-major) values of a field at a step
+  void read(size_t step, const std::string& name, std::vector<double>& values) const
+  {
+    const size_t target = field_index(name);
+    const unsigned char* p = data_.data() + steps_.at(step).second;
+    const unsigned char* end = p + stepSizes_.at(step);
+    compression::get_double(p, end);
+
+    std::vector<double> scratch;
+    for (size_t f = 0; f < fields_.size(); ++f) {
+      const size_t numEntities = fields_[f].ids.size();
+      const unsigned numComponents = fields_[f].numComponents;
+      std::vector<double>& dest = (f == target) ? values : scratch;
+      dest.assign(numEntities * numComponents, 0.0);
+      for (unsigned c = 0; c < numComponents; ++c)
+        compression::decompress_block(p, end, dest.data() + c, numEntities, numComponents);
+      if (f == target)
+        return;
+    }
+  }
+
+private:
+  struct FieldDef
+  {
+    std::string name;
+    unsigned numComponents{0};
+    std::vector<uint64_t> ids;
+  };
+
+  size_t field_index(const std::string& name) const
+  {
+    auto it = fieldIndex_.find(name);
+    if (it == fieldIndex_.end())
+      throw std::runtime_error("CompressedFieldFileReader: no field " + name);
+    return it->second;
+  }
+  const FieldDef& field(const std::string& name) const { return fields_[field_index(name)]; }
+
+  std::vector<unsigned char> data_;
+  std::vector<FieldDef> fields_;
+  std::map<std::string, size_t> fieldIndex_;
+  std::vector<std::pair<double, size_t>> steps_;
+  std::vector<size_t> stepSizes_;
+};
+
+} // namespace utils
+} // namespace nalu
+} // namespace sierra
+
+#endif /* FIELDCOMPRESSION_H */
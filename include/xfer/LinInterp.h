@@ -44,6 +44,10 @@ public :
       const MeshA     &FromElem,
       MeshB     &ToPoints) ;
     
+  static void build_operator (MeshB         &ToPoints,
+      const MeshA         &FromElem,
+      const EntityKeyMap &RangeToDomain) ;
+
   static void apply (MeshB         &ToPoints,
       const MeshA         &FromElem,
       const EntityKeyMap &RangeToDomain) ;
@@ -130,6 +134,9 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::filter_to_nearest (
     if (nearest != keys.second) RangeToDomain.erase(++nearest, keys.second);
   }
 
+  // a new fine search; the interpolation operator is compiled again on apply
+  ToPoints.interpOperatorValid_ = false;
+
   // parallel sum and output diagnostics
   double g_maxBestX = 0.0;
   size_t g_maxCandidateBoundngBox = 0;
@@ -143,29 +150,36 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::filter_to_nearest (
   NaluEnv::self().naluOutputP0() << "  Should max normalized distance and/or candidate bounding box size be too large, please check setup" << std::endl;
  }
 
-template <class FROM, class TO>  void LinInterp<FROM,TO>::apply 
+template <class FROM, class TO>  void LinInterp<FROM,TO>::build_operator
        (MeshB              &ToPoints,
         const MeshA        &FromElem,
         const EntityKeyMap &RangeToDomain) {
-  
+
   const stk::mesh::BulkData &fromBulkData = FromElem.fromBulkData_;
   stk::mesh::BulkData         &toBulkData = ToPoints.toBulkData_;
- 
+
+  ToPoints.interpTargets_.clear();
+  ToPoints.interpRowPtr_.assign(1, 0);
+  ToPoints.interpSources_.clear();
+  ToPoints.interpWeights_.clear();
+
+  // unit nodal values recover the shape functions from interpolatePoint
+  std::vector<double> unitCoeff;
+  std::vector<double> weights;
+
   typename EntityKeyMap::const_iterator ii;
-  for(ii=RangeToDomain.begin(); ii!=RangeToDomain.end(); ++ii ) { 
-    
+  for(ii=RangeToDomain.begin(); ii!=RangeToDomain.end(); ++ii ) {
+
     const stk::mesh::EntityKey thePt  = ii->first;
-    const stk::mesh::EntityKey theBox = ii->second; 
-    
-    if (1 != ToPoints.TransferInfo_.count(thePt)) {
-      if (0 == ToPoints.TransferInfo_.count(thePt)) 
-        throw std::runtime_error("Key not found in database");
-      else  
-        throw std::runtime_error("Too many Keys found in database");
-    }
-    const std::vector<double> &isoParCoords_ = ToPoints.TransferInfo_[thePt];
+    const stk::mesh::EntityKey theBox = ii->second;
+
+    typename MeshB::TransferInfo::const_iterator itp = ToPoints.TransferInfo_.find(thePt);
+    if ( itp == ToPoints.TransferInfo_.end() )
+      throw std::runtime_error("Key not found in database");
+    const std::vector<double> &isoParCoords_ = itp->second;
+
     stk::mesh::Entity theNode =   toBulkData.get_entity(thePt);
-    stk::mesh::Entity theElem = fromBulkData.get_entity(theBox);    
+    stk::mesh::Entity theElem = fromBulkData.get_entity(theBox);
 
     const stk::mesh::Bucket &theBucket = fromBulkData.bucket(theElem);
     const stk::topology &theElemTopo = theBucket.topology();
@@ -175,53 +189,92 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::apply
     const int num_nodes = fromBulkData.num_nodes(theElem);
     const int nodesPerElement = meSCS->nodesPerElement_;
 
-    for (unsigned n=0; n!=FromElem.fromFieldVec_.size(); ++n) {
+    unitCoeff.assign(nodesPerElement*nodesPerElement, 0.0);
+    for ( int ni = 0; ni < nodesPerElement; ++ni )
+      unitCoeff[ni*nodesPerElement + ni] = 1.0;
+    weights.resize(nodesPerElement);
+    meSCS->interpolatePoint(nodesPerElement,
+                            &isoParCoords_[0],
+                            &unitCoeff[0],
+                            &weights[0]);
+
+    ToPoints.interpTargets_.push_back(theNode);
+    for ( int ni = 0; ni < num_nodes; ++ni ) {
+      ToPoints.interpSources_.push_back(elem_node_rels[ni]);
+      ToPoints.interpWeights_.push_back(weights[ni]);
+    }
+    ToPoints.interpRowPtr_.push_back(ToPoints.interpSources_.size());
+  }
 
-      // extract field
-      const stk::mesh::FieldBase *toFieldBaseField = ToPoints.toFieldVec_[n];
+  // clipping is per field; resolve it once
+  ToPoints.interpClip_.clear();
+  for (unsigned n=0; n!=ToPoints.toFieldVec_.size(); ++n) {
+    double clipMin = std::numeric_limits<double>::lowest();
+    double clipMax = std::numeric_limits<double>::max();
+    std::map<std::string, std::pair<double,double> >::const_iterator itc
+      = ToPoints.clipMap_.find(ToPoints.toFieldVec_[n]->name());
+    if ( itc != ToPoints.clipMap_.end() ) {
+      clipMin = (*itc).second.first;
+      clipMax = (*itc).second.second;
+    }
+    ToPoints.interpClip_.push_back(std::make_pair(clipMin, clipMax));
+  }
 
-      // extract field name
-      const std::string fieldName = toFieldBaseField->name();
-      
-      // find any clipping
-      double clipMin = std::numeric_limits<double>::lowest();
-      double clipMax = std::numeric_limits<double>::max();
-      std::map<std::string, std::pair<double,double> >::iterator itc
-        = ToPoints.clipMap_.find(fieldName);
-      if ( itc != ToPoints.clipMap_.end() ) {
-        clipMin = (*itc).second.first;
-        clipMax = (*itc).second.second;
-      }
+  ToPoints.interpFromSyncCount_ = fromBulkData.synchronized_count();
+  ToPoints.interpToSyncCount_ = toBulkData.synchronized_count();
+  ToPoints.interpOperatorValid_ = true;
+}
 
-      // FixMe: integers are problematic for now...
-      const size_t sizeOfField = field_bytes_per_entity(*toFieldBaseField, theNode) / sizeof(double);
-      std::vector <double > Coeff(nodesPerElement*sizeOfField);
+template <class FROM, class TO>  void LinInterp<FROM,TO>::apply 
+       (MeshB              &ToPoints,
+        const MeshA        &FromElem,
+        const EntityKeyMap &RangeToDomain) {
+  
+  const stk::mesh::BulkData &fromBulkData = FromElem.fromBulkData_;
+  stk::mesh::BulkData         &toBulkData = ToPoints.toBulkData_;
 
-      // now load the elemental values for future interpolation; fill in connected nodes
-      for ( int ni = 0; ni < num_nodes; ++ni ) { 
-        stk::mesh::Entity node = elem_node_rels[ni];
+  // compile once per fine search; entities are revalidated on mesh modification
+  if ( !ToPoints.interpOperatorValid_
+       || ToPoints.interpFromSyncCount_ != fromBulkData.synchronized_count()
+       || ToPoints.interpToSyncCount_ != toBulkData.synchronized_count() )
+    build_operator(ToPoints, FromElem, RangeToDomain);
 
-        const stk::mesh::FieldBase *fromFieldBaseField = FromElem.fromFieldVec_[n];
-        const double *theField = (double*)stk::mesh::field_data(*fromFieldBaseField, node );
+  const size_t numFields = FromElem.fromFieldVec_.size();
+  const std::vector<stk::mesh::Entity> &targets = ToPoints.interpTargets_;
+  const std::vector<size_t> &rowPtr = ToPoints.interpRowPtr_;
+  const std::vector<stk::mesh::Entity> &sources = ToPoints.interpSources_;
+  const std::vector<double> &weights = ToPoints.interpWeights_;
 
-        for ( size_t j = 0; j < sizeOfField; ++j) {
-          const int offSet = j*nodesPerElement + ni; 
-          Coeff[offSet] = theField[j];
-        }   
-      }
+  std::vector<double> result;
+
+  // one pass over the rows; all fields of a target point together
+  for ( size_t r = 0; r < targets.size(); ++r ) {
+    stk::mesh::Entity theNode = targets[r];
+
+    for ( size_t n = 0; n < numFields; ++n ) {
+      const stk::mesh::FieldBase *toFieldBaseField = ToPoints.toFieldVec_[n];
+      const stk::mesh::FieldBase *fromFieldBaseField = FromElem.fromFieldVec_[n];
 
+      // FixMe: integers are problematic for now...
+      const size_t sizeOfField = field_bytes_per_entity(*toFieldBaseField, theNode) / sizeof(double);
       double * toField = (double*)stk::mesh::field_data(*toFieldBaseField, theNode);
       if (!toField) throw std::runtime_error("Receiving field undefined on mesh object.");
-      meSCS->interpolatePoint(sizeOfField,
-                              &isoParCoords_[0],
-                              &Coeff[0],
-                              toField);
+
+      result.assign(sizeOfField, 0.0);
+      for ( size_t k = rowPtr[r]; k < rowPtr[r+1]; ++k ) {
+        const double w = weights[k];
+        const double *theField = (double*)stk::mesh::field_data(*fromFieldBaseField, sources[k]);
+        for ( size_t j = 0; j < sizeOfField; ++j )
+          result[j] += w*theField[j];
+      }
 
       // clip it
+      const double clipMin = ToPoints.interpClip_[n].first;
+      const double clipMax = ToPoints.interpClip_[n].second;
       for ( size_t j = 0; j < sizeOfField; ++j) {
-        toField[j] = std::min(clipMax, std::max(toField[j],clipMin));
+        toField[j] = std::min(clipMax, std::max(result[j],clipMin));
       }
-    }   
+    }
   }
 }
 
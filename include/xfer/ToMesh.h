@@ -124,7 +124,10 @@ public :
     toFieldVec_   (get_fields(toMetaData, VarPairName)),
     comm_(comm),
     radius_(radius),
-    clipMap_(clipMap)
+    clipMap_(clipMap),
+    interpOperatorValid_(false),
+    interpFromSyncCount_(0),
+    interpToSyncCount_(0)
     {
       // nothing to do
     }
@@ -198,6 +201,17 @@ public :
   typedef std::map<stk::mesh::EntityKey, std::vector<double> > TransferInfo;
   TransferInfo TransferInfo_;
 
+  // precompiled interpolation operator in CSR form; row r maps the from nodes
+  // interpSources_[interpRowPtr_[r],interpRowPtr_[r+1]) onto interpTargets_[r]
+  bool interpOperatorValid_;
+  size_t interpFromSyncCount_;
+  size_t interpToSyncCount_;
+  std::vector<stk::mesh::Entity> interpTargets_;
+  std::vector<size_t> interpRowPtr_;
+  std::vector<stk::mesh::Entity> interpSources_;
+  std::vector<double> interpWeights_;
+  std::vector<std::pair<double,double> > interpClip_;
+
 };
 
 } // namespace nalu